@@ -0,0 +1,409 @@
+// Benchmark do host: custo por frame dos caminhos quentes do firmware
+// (desenho do OLED, envio ao display, empacotamento da matriz WS2812,
+// conversão dos sensores e avaliação dos alarmes), com o tráfego gravado
+// pelo HAL do host em cada periférico.
+//
+// Uso: bench [--frames N] [--save arquivo] [--baseline arquivo [--tolerance pct]]
+// Com --baseline, termina com status 1 se algum caso ficar mais lento que a
+// referência além da tolerância (padrão 20%).
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "pico/stdlib.h"
+#include "hardware/i2c.h"
+#include "host_hal.h"
+
+#include "lib/ssd1306.h"
+#include "lib/ws2812b.h"
+#include "lib/adc_sampler.h"
+#include "lib/fixed_point.h"
+#include "lib/alarm_rules.h"
+#include "lib/room_store.h"
+#include "lib/history.h"
+#include "lib/chart.h"
+#include "lib/profile.h"
+#include "lib/widget.h"
+#include "lib/led_matrix_anim.h"
+#include "lib/app_config.h" // Mesma configuração do firmware
+
+#define BENCH_DEFAULT_FRAMES 2000
+#define BENCH_RUNS 7 // Repetições; vale a mais rápida (menos ruído do host)
+#define BENCH_MAX_CASES 16
+
+typedef struct
+{
+    const char *name;
+    void (*frame)(uint32_t n);
+} bench_case_t;
+
+typedef struct
+{
+    const char *name;
+    double ns;          // Menor tempo por frame entre as repetições
+    double i2c_bytes;   // Bytes no I2C por frame
+    double pio_words;   // Palavras no FIFO da PIO por frame
+} bench_result_t;
+
+static ssd1306_buffers_t display_buffers;
+static ssd1306_t ssd;
+static room_store_t rooms;
+static const centi_t *const room_metrics[ALARM_METRIC_COUNT] = {
+    [ALARM_METRIC_TEMPERATURE] = rooms.temperature,
+    [ALARM_METRIC_HUMIDITY] = rooms.humidity,
+};
+static history_series_t history_series[NUM_ROOM * ALARM_METRIC_COUNT];
+static history_t history;
+static alarm_rule_t alarm_rules[NUM_RULES];
+static alarm_rule_state_t alarm_rule_states[NUM_RULES];
+static alarm_action_t alarm_actions[NUM_ACTIONS];
+static uint8_t alarm_action_refs[NUM_ACTIONS];
+static chart_series_t chart;
+static profile_stage_t profile_stages[] = {PROFILE_STAGE("bench")};
+static centi_t widget_temperature;
+static centi_t widget_humidity;
+
+static void format_centi(char *text, const void *value)
+{
+    char number[12];
+    fixed_format(number, *(const centi_t *)value, 0, 3);
+    snprintf(text, WIDGET_TEXT_MAX + 1, "%s", number);
+}
+
+static widget_field_t widget_fields[] = {
+    WIDGET_LABEL(30, 4, "Zona 01"),
+    WIDGET_FIELD(30, 26, "Temp:", widget_temperature, format_centi),
+    WIDGET_FIELD(30, 37, "Hum:", widget_humidity, format_centi),
+};
+static widget_screen_t widget_screen;
+static led_anim_t matrix_anim;
+
+static uint64_t now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000u + ts.tv_nsec;
+}
+
+// Joystick roteirizado: rampas lentas e defasadas em cada eixo.
+static uint16_t joystick_source(uint8_t input, uint64_t n, void *ctx)
+{
+    uint32_t phase = (uint32_t)(n / 64 + input * 1500) % 8192;
+    return phase < 4096 ? phase : 8191 - phase;
+}
+
+static void nop_action(uint32_t arg)
+{
+}
+
+// --- Casos -----------------------------------------------------------------
+
+// Tela de texto do firmware, com o ambiente mudando a cada frame.
+static void bench_render_text(uint32_t n)
+{
+    char text[20];
+    char value[12];
+    uint8_t room = n % rooms.count;
+
+    ssd1306_fill(&ssd, false);
+    ssd1306_draw_string(&ssd, room_store_name(&rooms, room), 30, 0);
+    snprintf(text, sizeof(text), "%02u de %02u", room + 1, rooms.count);
+    ssd1306_draw_string(&ssd, text, 30, 10);
+    fixed_format(value, rooms.temperature[room], 0, 0);
+    snprintf(text, sizeof(text), "%s°C", value);
+    ssd1306_draw_string_font(&ssd, &font_large, text, 30, 20);
+    fixed_format(value, rooms.humidity[room], 0, 3);
+    snprintf(text, sizeof(text), "Hum:%s%%", value);
+    ssd1306_draw_string(&ssd, text, 30, 22 + FONT_LARGE_HEIGHT);
+    ssd1306_draw_string(&ssd, room_store_cam_on(&rooms, room) ? "Cam:On" : "Cam:Off", 30, 56);
+}
+
+// Primitivas de desenho: retângulos, linhas e colunas.
+static void bench_render_shapes(uint32_t n)
+{
+    uint8_t k = n % 32;
+
+    ssd1306_fill(&ssd, false);
+    ssd1306_rect(&ssd, 0, 0, WIDTH, HEIGHT, true, false);
+    ssd1306_rect(&ssd, 8 + k / 4, 8 + k, 40, 24, true, true);
+    for (uint8_t x = 0; x < WIDTH; x += 8)
+        ssd1306_line(&ssd, x, 0, WIDTH - 1 - x, HEIGHT - 1, true);
+    for (uint8_t y = 4; y < HEIGHT; y += 12)
+        ssd1306_hline(&ssd, 0, WIDTH - 1, y, true);
+    for (uint8_t x = k; x < WIDTH; x += 16)
+        ssd1306_vline(&ssd, x, 0, HEIGHT - 1, true);
+}
+
+// Gráfico da camada bruta: consulta ao histórico, redução e desenho.
+static void bench_render_chart(uint32_t n)
+{
+    static history_bucket_t points[HISTORY_RAW_LEN];
+    uint8_t room = n % rooms.count;
+
+    uint16_t count = history_range(&history, room, ALARM_METRIC_TEMPERATURE, history_span_ms(0), points,
+                                   HISTORY_RAW_LEN);
+    chart_prepare(&chart, points, count, WIDTH, CHART_HEIGHT);
+    ssd1306_fill(&ssd, false);
+    chart_draw(&ssd, &chart, 0, 16);
+}
+
+// Desenho + envio ao display (diferença com o painel, DMA para o I2C).
+static void bench_oled_frame(uint32_t n)
+{
+    bench_render_text(n);
+    ssd1306_send_data(&ssd);
+}
+
+// Tela de texto em modo retido: a temperatura muda a cada 8 frames e a
+// umidade a cada 64, como em regime; o resto do tempo nada é desenhado.
+static void bench_oled_widgets(uint32_t n)
+{
+    if (n == 0) { // Outra tela estava no buffer
+        ssd1306_fill(&ssd, false);
+        widget_invalidate(&widget_screen);
+    }
+    widget_temperature = CENTI(20 + (n / 8) % 10);
+    widget_humidity = CENTI(40 + (n / 64) % 30);
+    widget_update(&ssd, &widget_screen);
+    ssd1306_send_data(&ssd);
+}
+
+// Matriz de LEDs: nível de temperatura em 25 LEDs, empacotado e enviado.
+static void bench_ws2812_frame(uint32_t n)
+{
+    uint8_t level = n % LED_MATRIX_COUNT;
+
+    for (uint8_t i = 0; i < LED_MATRIX_COUNT; ++i)
+        ws2812b_set_led(i, i <= level ? 200 : 0, 0, i <= level ? 0 : 200);
+    ws2812b_write();
+}
+
+// Animação da matriz: um frame de rolagem com transição cruzada, montado e
+// enviado; o texto muda a cada 256 frames.
+static void bench_matrix_scroll(uint32_t n)
+{
+    static const char *const texts[] = {"23.5°", "-4.0°", "41.2°"};
+
+    led_anim_set_text(&matrix_anim, texts[(n >> 8) % 3], 0, 200, 0);
+    led_anim_frame(&matrix_anim);
+    ws2812b_write();
+}
+
+// Brilho global: reempacota o buffer inteiro com uma nova escala.
+static void bench_ws2812_brightness(uint32_t n)
+{
+    ws2812b_set_brightness(n & 0xFF);
+}
+
+// Conversão dos sensores de todos os ambientes: amostras novas no buffer do
+// DMA, decimação e escala para centésimos, como em sample_task.
+static void bench_sensor_conversion(uint32_t n)
+{
+    host_adc_advance(2 * ADC_OVERSAMPLE_RATIO);
+    for (uint8_t i = 0; i < rooms.count; ++i) {
+        uint32_t x = adc_sampler_decimated(ADC_VRX_INPUT);
+        uint32_t y = adc_sampler_decimated(ADC_VRY_INPUT);
+        rooms.humidity[i] = fixed_from_adc(x, adc_sampler_resolution(ADC_VRX_INPUT), 100);
+        rooms.temperature[i] = fixed_from_adc(y, adc_sampler_resolution(ADC_VRY_INPUT), MAX_TEMP);
+    }
+}
+
+// Avaliação das 96 regras com leituras que cruzam os limiares.
+static void bench_alarm_evaluation(uint32_t n)
+{
+    for (uint8_t i = 0; i < rooms.count; ++i)
+        rooms.temperature[i] = CENTI(((n + i) * 7) % 60);
+    alarm_rules_evaluate(room_metrics);
+}
+
+// Uma amostra por ambiente e métrica no histórico multicamadas.
+static void bench_history_record(uint32_t n)
+{
+    history_record(&history, room_metrics);
+}
+
+// Custo da instrumentação de um estágio (PROFILE_BEGIN + PROFILE_END).
+static void bench_profile_overhead(uint32_t n)
+{
+    PROFILE_BEGIN(start_us);
+    PROFILE_END(&profile_stages[0], start_us);
+}
+
+static const bench_case_t cases[] = {
+    {"render_text", bench_render_text},
+    {"render_shapes", bench_render_shapes},
+    {"render_chart", bench_render_chart},
+    {"oled_frame", bench_oled_frame},
+    {"oled_widgets", bench_oled_widgets},
+    {"ws2812_frame", bench_ws2812_frame},
+    {"matrix_scroll", bench_matrix_scroll},
+    {"ws2812_brightness", bench_ws2812_brightness},
+    {"sensor_conversion", bench_sensor_conversion},
+    {"alarm_evaluation", bench_alarm_evaluation},
+    {"history_record", bench_history_record},
+    {"profile_overhead", bench_profile_overhead},
+};
+
+// --- Execução --------------------------------------------------------------
+
+static void setup(void)
+{
+    i2c_init(i2c1, 400 * 1000);
+    ssd1306_init(&ssd, WIDTH, HEIGHT, false, I2C_ADDRESS, i2c1, &display_buffers);
+    ssd1306_config(&ssd);
+    ssd1306_send_data(&ssd);
+    widget_screen_init(&widget_screen, widget_fields, count_of(widget_fields));
+
+    ws2812b_init(LED_MATRIX_PIN);
+    led_anim_init(&matrix_anim);
+
+    host_adc_script(ADC_VRX_INPUT, joystick_source, NULL);
+    host_adc_script(ADC_VRY_INPUT, joystick_source, NULL);
+    adc_sampler_init((1u << ADC_VRX_INPUT) | (1u << ADC_VRY_INPUT), ADC_SAMPLE_RATE_HZ);
+    adc_sampler_set_oversampling(ADC_VRX_INPUT, ADC_OVERSAMPLE_RATIO);
+    adc_sampler_set_oversampling(ADC_VRY_INPUT, ADC_OVERSAMPLE_RATIO);
+    host_adc_advance(ADC_SAMPLER_RING_SIZE);
+
+    room_store_init(&rooms);
+    for (int i = 0; i < NUM_ROOM; ++i) {
+        char name[ROOM_NAME_MAX];
+        snprintf(name, sizeof(name), "Zona %02d", i + 1);
+        room_store_add(&rooms, name);
+        rooms.temperature[i] = CENTI(20 + i % 10);
+        rooms.humidity[i] = CENTI(40 + i % 30);
+    }
+
+    // Regras do firmware (build_alarm_rules), com ações vazias
+    for (int i = 0; i < NUM_ACTIONS; ++i)
+        alarm_actions[i] = (alarm_action_t){nop_action, nop_action, i};
+    build_alarm_rules(alarm_rules);
+    alarm_rules_init(alarm_rules, alarm_rule_states, NUM_RULES, alarm_actions, alarm_action_refs, NUM_ACTIONS);
+
+    profile_init(profile_stages, count_of(profile_stages));
+    history_init(&history, history_series, NUM_ROOM, ALARM_METRIC_COUNT);
+    for (int i = 0; i < HISTORY_RAW_LEN; ++i) {
+        for (int r = 0; r < NUM_ROOM; ++r)
+            rooms.temperature[r] = CENTI(15) + (i * 37 + r * 11) % CENTI(20);
+        history_record(&history, room_metrics);
+    }
+}
+
+static int compare_double(const void *a, const void *b)
+{
+    double x = *(const double *)a, y = *(const double *)b;
+    return (x > y) - (x < y);
+}
+
+static bench_result_t run_case(const bench_case_t *c, uint32_t frames)
+{
+    bench_result_t result = {c->name, 0, 0, 0};
+    double runs[BENCH_RUNS];
+    size_t i2c_count, pio_count;
+
+    for (uint32_t n = 0; n < frames / 10; ++n) // Aquecimento
+        c->frame(n);
+    ws2812b_wait_latched();
+
+    for (int r = 0; r < BENCH_RUNS; ++r) {
+        host_i2c_clear();
+        host_pio_clear();
+        uint64_t start = now_ns();
+        for (uint32_t n = 0; n < frames; ++n)
+            c->frame(n);
+        runs[r] = (double)(now_ns() - start) / frames;
+        ws2812b_wait_latched(); // Frames pendentes saem fora da medição
+    }
+
+    qsort(runs, BENCH_RUNS, sizeof(double), compare_double);
+    host_i2c_events(&i2c_count);
+    host_pio_events(&pio_count);
+    result.ns = runs[0];
+    result.i2c_bytes = (double)i2c_count / frames;
+    result.pio_words = (double)pio_count / frames;
+    return result;
+}
+
+// Lê "nome ns" por linha; retorna o tempo de referência do caso ou 0.
+static double baseline_ns(FILE *file, const char *name)
+{
+    char line[128], key[64];
+    double ns;
+
+    rewind(file);
+    while (fgets(line, sizeof(line), file))
+        if (sscanf(line, "%63s %lf", key, &ns) == 2 && strcmp(key, name) == 0)
+            return ns;
+    return 0;
+}
+
+int main(int argc, char **argv)
+{
+    uint32_t frames = BENCH_DEFAULT_FRAMES;
+    const char *save_path = NULL, *baseline_path = NULL;
+    double tolerance = 20;
+    bench_result_t results[BENCH_MAX_CASES];
+    int regressions = 0;
+
+    for (int i = 1; i < argc; ++i) {
+        if (strcmp(argv[i], "--frames") == 0 && i + 1 < argc) {
+            frames = strtoul(argv[++i], NULL, 0);
+        } else if (strcmp(argv[i], "--save") == 0 && i + 1 < argc) {
+            save_path = argv[++i];
+        } else if (strcmp(argv[i], "--baseline") == 0 && i + 1 < argc) {
+            baseline_path = argv[++i];
+        } else if (strcmp(argv[i], "--tolerance") == 0 && i + 1 < argc) {
+            tolerance = strtod(argv[++i], NULL);
+        } else {
+            fprintf(stderr, "uso: %s [--frames N] [--save arquivo] [--baseline arquivo [--tolerance pct]]\n",
+                    argv[0]);
+            return 2;
+        }
+    }
+    if (frames == 0)
+        frames = 1;
+
+    setup();
+
+    FILE *baseline = NULL;
+    if (baseline_path != NULL && (baseline = fopen(baseline_path, "r")) == NULL) {
+        perror(baseline_path);
+        return 2;
+    }
+
+    printf("%-20s %12s %10s %10s %10s\n", "caso", "ns/frame", "ref", "i2c B/fr", "pio W/fr");
+    for (size_t i = 0; i < count_of(cases); ++i) {
+        results[i] = run_case(&cases[i], frames);
+        double ref = baseline != NULL ? baseline_ns(baseline, results[i].name) : 0;
+        bool slower = ref > 0 && results[i].ns > ref * (1 + tolerance / 100);
+        regressions += slower;
+
+        printf("%-20s %12.1f ", results[i].name, results[i].ns);
+        if (ref > 0)
+            printf("%+9.1f%%", (results[i].ns / ref - 1) * 100);
+        else
+            printf("%10s", "-");
+        printf(" %10.2f %10.2f%s\n", results[i].i2c_bytes, results[i].pio_words, slower ? "  REGRESSAO" : "");
+    }
+
+    if (baseline != NULL)
+        fclose(baseline);
+
+    if (save_path != NULL) {
+        FILE *file = fopen(save_path, "w");
+        if (file == NULL) {
+            perror(save_path);
+            return 2;
+        }
+        for (size_t i = 0; i < count_of(cases); ++i)
+            fprintf(file, "%s %.1f\n", results[i].name, results[i].ns);
+        fclose(file);
+    }
+
+    if (regressions > 0) {
+        printf("%d caso(s) acima de %.0f%% da referencia\n", regressions, tolerance);
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,815 @@
+// Implementação para o host do subconjunto do Pico SDK usado pelos módulos
+// de lib/. Um único núcleo emulado: alarmes e interrupções de DMA rodam no
+// fio principal sempre que o código espera (host_poll) e as interrupções
+// estão habilitadas. Transferências de DMA são feitas na hora do disparo.
+
+#include <string.h>
+#include <time.h>
+
+#include "pico/stdlib.h"
+#include "hardware/adc.h"
+#include "hardware/clocks.h"
+#include "hardware/dma.h"
+#include "hardware/i2c.h"
+#include "hardware/irq.h"
+#include "hardware/pio.h"
+#include "hardware/uart.h"
+#include "host_hal.h"
+
+#define HOST_ALARMS 16
+#define HOST_IRQ_HANDLERS 4
+#define HOST_SPIN_LOCKS 32
+#define HOST_ADC_INPUTS 5
+
+i2c_inst_t i2c0_inst = {.index = 0};
+i2c_inst_t i2c1_inst = {.index = 1};
+pio_hw_t pio0_hw = {.index = 0};
+pio_hw_t pio1_hw = {.index = 1};
+adc_hw_t adc_hw_inst;
+uart_inst_t uart0_inst = {.hw = {HOST_UART_IDLE}, .index = 0};
+uart_inst_t uart1_inst = {.hw = {HOST_UART_IDLE}, .index = 1};
+
+// --- Registros dos periféricos ---------------------------------------------
+
+// Vetor dinâmico de eventos de um periférico.
+typedef struct
+{
+    void *items;
+    size_t count, capacity, item_size;
+} host_log_t;
+
+static host_log_t i2c_log = {.item_size = sizeof(host_i2c_event_t)};
+static host_log_t pio_log = {.item_size = sizeof(host_pio_event_t)};
+static host_log_t gpio_log = {.item_size = sizeof(host_gpio_event_t)};
+static host_log_t uart_log = {.item_size = 1};
+
+static void host_log_push(host_log_t *log, const void *item)
+{
+    if (log->count == log->capacity)
+    {
+        log->capacity = log->capacity ? log->capacity * 2 : 1024;
+        log->items = realloc(log->items, log->capacity * log->item_size);
+        if (log->items == NULL)
+            abort();
+    }
+    memcpy((uint8_t *)log->items + log->count++ * log->item_size, item, log->item_size);
+}
+
+const host_i2c_event_t *host_i2c_events(size_t *count)
+{
+    *count = i2c_log.count;
+    return i2c_log.items;
+}
+
+const host_pio_event_t *host_pio_events(size_t *count)
+{
+    *count = pio_log.count;
+    return pio_log.items;
+}
+
+const host_gpio_event_t *host_gpio_events(size_t *count)
+{
+    *count = gpio_log.count;
+    return gpio_log.items;
+}
+
+const uint8_t *host_uart_bytes(size_t *count)
+{
+    *count = uart_log.count;
+    return uart_log.items;
+}
+
+void host_i2c_clear(void)
+{
+    i2c_log.count = 0;
+}
+
+void host_pio_clear(void)
+{
+    pio_log.count = 0;
+}
+
+void host_gpio_clear(void)
+{
+    gpio_log.count = 0;
+}
+
+void host_uart_clear(void)
+{
+    uart_log.count = 0;
+}
+
+// --- Tempo -----------------------------------------------------------------
+
+static uint64_t boot_ns = 0;
+
+uint64_t time_us_64(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    uint64_t ns = (uint64_t)ts.tv_sec * 1000000000u + ts.tv_nsec;
+    if (boot_ns == 0)
+        boot_ns = ns;
+    return (ns - boot_ns) / 1000u;
+}
+
+uint32_t time_us_32(void)
+{
+    return (uint32_t)time_us_64();
+}
+
+absolute_time_t get_absolute_time(void)
+{
+    return time_us_64();
+}
+
+uint32_t to_ms_since_boot(absolute_time_t t)
+{
+    return (uint32_t)(t / 1000u);
+}
+
+uint64_t to_us_since_boot(absolute_time_t t)
+{
+    return t;
+}
+
+absolute_time_t make_timeout_time_us(uint64_t us)
+{
+    return time_us_64() + us;
+}
+
+absolute_time_t make_timeout_time_ms(uint32_t ms)
+{
+    return time_us_64() + (uint64_t)ms * 1000u;
+}
+
+absolute_time_t delayed_by_us(absolute_time_t t, uint64_t us)
+{
+    return t + us;
+}
+
+absolute_time_t delayed_by_ms(absolute_time_t t, uint32_t ms)
+{
+    return t + (uint64_t)ms * 1000u;
+}
+
+// --- Interrupções ----------------------------------------------------------
+
+static bool irqs_disabled = false;
+static bool in_irq = false;
+static bool irq_line_enabled[NUM_IRQS];
+static irq_handler_t irq_handlers[NUM_IRQS][HOST_IRQ_HANDLERS];
+
+static struct
+{
+    alarm_id_t id;
+    uint64_t due_us;
+    alarm_callback_t callback;
+    void *user_data;
+} alarms[HOST_ALARMS];
+static alarm_id_t next_alarm_id = 1;
+
+static struct
+{
+    bool claimed;
+    bool busy;
+    bool adc_stream; // Lê o FIFO do ADC: avança com host_adc_advance
+    dma_channel_config config;
+    dma_channel_hw_t hw;
+    volatile void *write_addr;
+    const volatile void *read_addr;
+    bool irq_enabled[2];
+    bool irq_status[2];
+} dma[NUM_DMA_CHANNELS];
+
+uint32_t save_and_disable_interrupts(void)
+{
+    uint32_t status = irqs_disabled;
+    irqs_disabled = true;
+    return status;
+}
+
+void restore_interrupts(uint32_t status)
+{
+    irqs_disabled = status;
+    host_poll();
+}
+
+void irq_set_exclusive_handler(unsigned int num, irq_handler_t handler)
+{
+    memset(irq_handlers[num], 0, sizeof(irq_handlers[num]));
+    irq_handlers[num][0] = handler;
+}
+
+void irq_add_shared_handler(unsigned int num, irq_handler_t handler, uint8_t order_priority)
+{
+    for (int i = 0; i < HOST_IRQ_HANDLERS; ++i)
+    {
+        if (irq_handlers[num][i] == NULL)
+        {
+            irq_handlers[num][i] = handler;
+            return;
+        }
+    }
+    panic("irq_add_shared_handler: sem espaço");
+}
+
+void irq_set_enabled(unsigned int num, bool enabled)
+{
+    irq_line_enabled[num] = enabled;
+    host_poll();
+}
+
+// Linha de DMA com algum canal sinalizando.
+static bool dma_irq_pending(uint8_t line)
+{
+    for (int ch = 0; ch < NUM_DMA_CHANNELS; ++ch)
+        if (dma[ch].irq_enabled[line] && dma[ch].irq_status[line])
+            return true;
+    return false;
+}
+
+void host_poll(void)
+{
+    if (irqs_disabled || in_irq)
+        return;
+    in_irq = true;
+
+    for (uint8_t line = 0; line < 2; ++line)
+    {
+        unsigned int num = line ? DMA_IRQ_1 : DMA_IRQ_0;
+        for (int guard = 0; irq_line_enabled[num] && dma_irq_pending(line) && guard < 8; ++guard)
+            for (int i = 0; i < HOST_IRQ_HANDLERS && irq_handlers[num][i] != NULL; ++i)
+                irq_handlers[num][i]();
+    }
+
+    uint64_t now = time_us_64();
+    for (int i = 0; i < HOST_ALARMS; ++i)
+    {
+        if (alarms[i].id == 0 || alarms[i].due_us > now)
+            continue;
+        alarm_id_t id = alarms[i].id;
+        alarms[i].id = 0;
+        int64_t again = alarms[i].callback(id, alarms[i].user_data);
+        if (again != 0)
+        {
+            alarms[i].id = id;
+            alarms[i].due_us = again > 0 ? now + again : alarms[i].due_us - again;
+        }
+    }
+
+    in_irq = false;
+}
+
+void tight_loop_contents(void)
+{
+    host_poll();
+}
+
+void __wfe(void)
+{
+    struct timespec ts = {0, 10000};
+    host_poll();
+    nanosleep(&ts, NULL);
+    host_poll();
+}
+
+void __wfi(void)
+{
+    __wfe();
+}
+
+void __sev(void)
+{
+}
+
+// --- Alarmes e espera ------------------------------------------------------
+
+alarm_id_t add_alarm_in_us(uint64_t us, alarm_callback_t callback, void *user_data, bool fire_if_past)
+{
+    for (int i = 0; i < HOST_ALARMS; ++i)
+    {
+        if (alarms[i].id == 0)
+        {
+            alarms[i].id = next_alarm_id++;
+            alarms[i].due_us = time_us_64() + us;
+            alarms[i].callback = callback;
+            alarms[i].user_data = user_data;
+            return alarms[i].id;
+        }
+    }
+    return -1;
+}
+
+alarm_id_t add_alarm_in_ms(uint32_t ms, alarm_callback_t callback, void *user_data, bool fire_if_past)
+{
+    return add_alarm_in_us((uint64_t)ms * 1000u, callback, user_data, fire_if_past);
+}
+
+bool cancel_alarm(alarm_id_t id)
+{
+    for (int i = 0; i < HOST_ALARMS; ++i)
+    {
+        if (alarms[i].id == id)
+        {
+            alarms[i].id = 0;
+            return true;
+        }
+    }
+    return false;
+}
+
+void busy_wait_us(uint64_t us)
+{
+    uint64_t end = time_us_64() + us;
+    while (time_us_64() < end)
+        host_poll();
+}
+
+void sleep_us(uint64_t us)
+{
+    busy_wait_us(us);
+}
+
+void sleep_ms(uint32_t ms)
+{
+    busy_wait_us((uint64_t)ms * 1000u);
+}
+
+bool best_effort_wfe_or_timeout(absolute_time_t timeout)
+{
+    __wfe();
+    return time_us_64() >= timeout;
+}
+
+bool stdio_init_all(void)
+{
+    return true;
+}
+
+// --- Spin locks ------------------------------------------------------------
+
+static spin_lock_t spin_locks[HOST_SPIN_LOCKS];
+static uint32_t spin_locks_claimed = 0;
+
+int spin_lock_claim_unused(bool required)
+{
+    for (int i = 0; i < HOST_SPIN_LOCKS; ++i)
+    {
+        if (!(spin_locks_claimed & (1u << i)))
+        {
+            spin_locks_claimed |= 1u << i;
+            return i;
+        }
+    }
+    if (required)
+        panic("spin_lock_claim_unused");
+    return -1;
+}
+
+spin_lock_t *spin_lock_instance(unsigned int lock_num)
+{
+    return &spin_locks[lock_num];
+}
+
+uint32_t spin_lock_blocking(spin_lock_t *lock)
+{
+    return save_and_disable_interrupts();
+}
+
+void spin_unlock(spin_lock_t *lock, uint32_t saved_irq)
+{
+    restore_interrupts(saved_irq);
+}
+
+// --- GPIO ------------------------------------------------------------------
+
+static bool gpio_values[NUM_BANK0_GPIOS];
+
+void gpio_init(unsigned int gpio)
+{
+    gpio_values[gpio] = false;
+}
+
+void gpio_set_dir(unsigned int gpio, bool out)
+{
+}
+
+void gpio_pull_up(unsigned int gpio)
+{
+    gpio_values[gpio] = true;
+}
+
+void gpio_put(unsigned int gpio, bool value)
+{
+    if (gpio_values[gpio] == value)
+        return;
+    gpio_values[gpio] = value;
+    host_gpio_event_t event = {gpio, value, time_us_64()};
+    host_log_push(&gpio_log, &event);
+}
+
+bool gpio_get(unsigned int gpio)
+{
+    return gpio_values[gpio];
+}
+
+void gpio_set_function(unsigned int gpio, enum gpio_function fn)
+{
+}
+
+void gpio_set_irq_enabled(unsigned int gpio, uint32_t events, bool enabled)
+{
+}
+
+void gpio_set_irq_enabled_with_callback(unsigned int gpio, uint32_t events, bool enabled,
+                                        gpio_irq_callback_t callback)
+{
+}
+
+// --- I2C, PIO e UART -------------------------------------------------------
+
+unsigned int i2c_init(i2c_inst_t *i2c, unsigned int baudrate)
+{
+    // Mesma divisão do SDK: período do SCL em ciclos de clk_peri, 60% em nível baixo
+    uint32_t period = (clock_get_hz(clk_peri) + baudrate / 2) / baudrate;
+    i2c->hw.fs_scl_lcnt = period * 3 / 5;
+    i2c->hw.fs_scl_hcnt = period - i2c->hw.fs_scl_lcnt;
+    i2c->hw.status = I2C_IC_STATUS_TFE_BITS;
+    return (unsigned int)(clock_get_hz(clk_peri) / period);
+}
+
+int i2c_write_blocking(i2c_inst_t *i2c, uint8_t addr, const uint8_t *src, size_t len, bool nostop)
+{
+    for (size_t i = 0; i < len; ++i)
+    {
+        host_i2c_event_t event = {addr, src[i], !nostop && i == len - 1};
+        host_log_push(&i2c_log, &event);
+    }
+    return (int)len;
+}
+
+unsigned int pio_add_program(PIO pio, const pio_program_t *program)
+{
+    return 0;
+}
+
+int pio_claim_unused_sm(PIO pio, bool required)
+{
+    for (int sm = 0; sm < 4; ++sm)
+    {
+        if (!(pio->claimed & (1u << sm)))
+        {
+            pio->claimed |= 1u << sm;
+            return sm;
+        }
+    }
+    if (required)
+        panic("pio_claim_unused_sm");
+    return -1;
+}
+
+void pio_sm_put_blocking(PIO pio, unsigned int sm, uint32_t data)
+{
+    host_pio_event_t event = {pio->index, sm, data};
+    host_log_push(&pio_log, &event);
+}
+
+// Registra o byte escrito em dr desde a última consulta.
+static void uart_collect(uart_inst_t *uart)
+{
+    if (uart->hw.dr != HOST_UART_IDLE)
+    {
+        uint8_t byte = (uint8_t)uart->hw.dr;
+        host_log_push(&uart_log, &byte);
+        uart->hw.dr = HOST_UART_IDLE;
+    }
+}
+
+bool uart_is_writable(uart_inst_t *uart)
+{
+    uart_collect(uart);
+    return true;
+}
+
+void uart_set_irq_enables(uart_inst_t *uart, bool rx_has_data, bool tx_needs_data)
+{
+    uart_collect(uart);
+}
+
+// --- ADC -------------------------------------------------------------------
+
+static struct
+{
+    host_adc_source_t source;
+    void *ctx;
+    uint64_t conversions;
+    uint16_t constant;
+} adc_inputs[HOST_ADC_INPUTS];
+static uint8_t adc_input = 0;
+static uint8_t adc_round_robin = 0;
+
+static uint16_t adc_convert(uint8_t input)
+{
+    uint64_t n = adc_inputs[input].conversions++;
+    if (adc_inputs[input].source != NULL)
+        return adc_inputs[input].source(input, n, adc_inputs[input].ctx) & 0x0FFF;
+    return adc_inputs[input].constant;
+}
+
+void host_adc_script(uint8_t input, host_adc_source_t source, void *ctx)
+{
+    adc_inputs[input].source = source;
+    adc_inputs[input].ctx = ctx;
+}
+
+void host_adc_set_constant(uint8_t input, uint16_t value)
+{
+    adc_inputs[input].source = NULL;
+    adc_inputs[input].constant = value & 0x0FFF;
+}
+
+void adc_init(void)
+{
+}
+
+void adc_gpio_init(unsigned int gpio)
+{
+}
+
+void adc_select_input(unsigned int input)
+{
+    adc_input = input;
+}
+
+void adc_set_round_robin(unsigned int input_mask)
+{
+    adc_round_robin = input_mask;
+}
+
+void adc_fifo_setup(bool en, bool dreq_en, uint16_t dreq_thresh, bool err_in_fifo, bool byte_shift)
+{
+}
+
+void adc_set_clkdiv(float clkdiv)
+{
+}
+
+void adc_run(bool run)
+{
+}
+
+uint16_t adc_read(void)
+{
+    return adc_convert(adc_input);
+}
+
+// Próxima entrada do round-robin, em ordem crescente.
+static void adc_next_input(void)
+{
+    if (adc_round_robin == 0)
+        return;
+    do
+        adc_input = (adc_input + 1) % HOST_ADC_INPUTS;
+    while (!(adc_round_robin & (1u << adc_input)));
+}
+
+static void dma_complete(unsigned int channel);
+
+void host_adc_advance(uint32_t count)
+{
+    for (int ch = 0; ch < NUM_DMA_CHANNELS; ++ch)
+    {
+        if (!dma[ch].adc_stream || !dma[ch].busy)
+            continue;
+
+        uintptr_t addr = (uintptr_t)dma[ch].write_addr;
+        uintptr_t ring_mask = dma[ch].config.ring_write && dma[ch].config.ring_bits
+                                  ? ((uintptr_t)1 << dma[ch].config.ring_bits) - 1
+                                  : UINTPTR_MAX;
+        for (uint32_t i = 0; i < count && dma[ch].hw.transfer_count > 0; ++i)
+        {
+            *(volatile uint16_t *)addr = adc_convert(adc_input);
+            adc_next_input();
+            addr = (addr & ~ring_mask) | ((addr + 2) & ring_mask);
+            if (--dma[ch].hw.transfer_count == 0)
+                dma_complete(ch);
+        }
+        dma[ch].write_addr = (volatile void *)addr;
+        dma[ch].hw.write_addr = (uint32_t)addr;
+    }
+    host_poll();
+}
+
+// --- DMA -------------------------------------------------------------------
+
+int dma_claim_unused_channel(bool required)
+{
+    for (int ch = 0; ch < NUM_DMA_CHANNELS; ++ch)
+    {
+        if (!dma[ch].claimed)
+        {
+            dma[ch].claimed = true;
+            return ch;
+        }
+    }
+    if (required)
+        panic("dma_claim_unused_channel");
+    return -1;
+}
+
+dma_channel_config dma_channel_get_default_config(unsigned int channel)
+{
+    dma_channel_config c = {DMA_SIZE_32, true, false, false, 0, DREQ_FORCE};
+    return c;
+}
+
+void channel_config_set_transfer_data_size(dma_channel_config *c, enum dma_channel_transfer_size size)
+{
+    c->size = size;
+}
+
+void channel_config_set_read_increment(dma_channel_config *c, bool incr)
+{
+    c->read_increment = incr;
+}
+
+void channel_config_set_write_increment(dma_channel_config *c, bool incr)
+{
+    c->write_increment = incr;
+}
+
+void channel_config_set_ring(dma_channel_config *c, bool write, unsigned int size_bits)
+{
+    c->ring_write = write;
+    c->ring_bits = size_bits;
+}
+
+void channel_config_set_dreq(dma_channel_config *c, unsigned int dreq)
+{
+    c->dreq = dreq;
+}
+
+static void dma_complete(unsigned int channel)
+{
+    dma[channel].busy = false;
+    for (int line = 0; line < 2; ++line)
+        if (dma[channel].irq_enabled[line])
+            dma[channel].irq_status[line] = true;
+}
+
+static uint32_t dma_read_element(const volatile uint8_t *src, uint8_t size)
+{
+    switch (size)
+    {
+    case DMA_SIZE_8:
+        return *src;
+    case DMA_SIZE_16:
+        return *(const volatile uint16_t *)src;
+    default:
+        return *(const volatile uint32_t *)src;
+    }
+}
+
+// Escreve um elemento no destino, registrando se for um periférico.
+static void dma_write_element(volatile void *dst, uint32_t value, uint8_t size)
+{
+    i2c_inst_t *i2cs[2] = {i2c0, i2c1};
+    PIO pios[2] = {pio0, pio1};
+    uart_inst_t *uarts[2] = {uart0, uart1};
+
+    for (int i = 0; i < 2; ++i)
+    {
+        if (dst == &i2cs[i]->hw.data_cmd)
+        {
+            host_i2c_event_t event = {(uint8_t)i2cs[i]->hw.tar, (uint8_t)value,
+                                      (value & I2C_IC_DATA_CMD_STOP_BITS) != 0};
+            host_log_push(&i2c_log, &event);
+            return;
+        }
+        for (uint8_t sm = 0; sm < 4; ++sm)
+        {
+            if (dst == &pios[i]->txf[sm])
+            {
+                host_pio_event_t event = {(uint8_t)i, sm, value};
+                host_log_push(&pio_log, &event);
+                return;
+            }
+        }
+        if (dst == &uarts[i]->hw.dr)
+        {
+            uint8_t byte = (uint8_t)value;
+            host_log_push(&uart_log, &byte);
+            return;
+        }
+    }
+
+    if (size == DMA_SIZE_8)
+        *(volatile uint8_t *)dst = (uint8_t)value;
+    else if (size == DMA_SIZE_16)
+        *(volatile uint16_t *)dst = (uint16_t)value;
+    else
+        *(volatile uint32_t *)dst = value;
+}
+
+// Executa a transferência inteira; o canal do ADC fica ativo e avança aos poucos.
+static void dma_start(unsigned int channel)
+{
+    if (dma[channel].read_addr == (const volatile void *)&adc_hw->fifo)
+    {
+        dma[channel].adc_stream = true;
+        dma[channel].busy = dma[channel].hw.transfer_count > 0;
+        return;
+    }
+
+    uint8_t size = dma[channel].config.size;
+    uint8_t step = 1u << size;
+    const volatile uint8_t *src = dma[channel].read_addr;
+    volatile uint8_t *dst = dma[channel].write_addr;
+
+    for (uint32_t i = 0; i < dma[channel].hw.transfer_count; ++i)
+    {
+        dma_write_element(dst, dma_read_element(src, size), size);
+        if (dma[channel].config.read_increment)
+            src += step;
+        if (dma[channel].config.write_increment)
+            dst += step;
+    }
+    dma[channel].hw.transfer_count = 0;
+    dma_complete(channel);
+    host_poll();
+}
+
+void dma_channel_configure(unsigned int channel, const dma_channel_config *config, volatile void *write_addr,
+                           const volatile void *read_addr, unsigned int transfer_count, bool trigger)
+{
+    dma[channel].config = *config;
+    dma[channel].write_addr = write_addr;
+    dma[channel].read_addr = read_addr;
+    dma[channel].hw.write_addr = (uint32_t)(uintptr_t)write_addr;
+    dma[channel].hw.read_addr = (uint32_t)(uintptr_t)read_addr;
+    dma[channel].hw.transfer_count = transfer_count;
+    if (trigger)
+        dma_start(channel);
+}
+
+void dma_channel_transfer_from_buffer_now(unsigned int channel, const volatile void *read_addr,
+                                          uint32_t transfer_count)
+{
+    dma[channel].read_addr = read_addr;
+    dma[channel].hw.read_addr = (uint32_t)(uintptr_t)read_addr;
+    dma[channel].hw.transfer_count = transfer_count;
+    dma_start(channel);
+}
+
+void dma_channel_set_trans_count(unsigned int channel, uint32_t trans_count, bool trigger)
+{
+    dma[channel].hw.transfer_count = trans_count;
+    if (trigger)
+        dma_start(channel);
+}
+
+void dma_channel_abort(unsigned int channel)
+{
+    dma[channel].busy = false;
+}
+
+bool dma_channel_is_busy(unsigned int channel)
+{
+    return dma[channel].busy;
+}
+
+dma_channel_hw_t *dma_channel_hw_addr(unsigned int channel)
+{
+    return &dma[channel].hw;
+}
+
+void dma_channel_set_irq0_enabled(unsigned int channel, bool enabled)
+{
+    dma[channel].irq_enabled[0] = enabled;
+}
+
+void dma_channel_set_irq1_enabled(unsigned int channel, bool enabled)
+{
+    dma[channel].irq_enabled[1] = enabled;
+}
+
+bool dma_channel_get_irq0_status(unsigned int channel)
+{
+    return dma[channel].irq_status[0];
+}
+
+bool dma_channel_get_irq1_status(unsigned int channel)
+{
+    return dma[channel].irq_status[1];
+}
+
+void dma_channel_acknowledge_irq0(unsigned int channel)
+{
+    dma[channel].irq_status[0] = false;
+}
+
+void dma_channel_acknowledge_irq1(unsigned int channel)
+{
+    dma[channel].irq_status[1] = false;
+}
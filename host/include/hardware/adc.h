@@ -0,0 +1,24 @@
+#ifndef HOST_HARDWARE_ADC_H
+#define HOST_HARDWARE_ADC_H
+
+#include "pico/stdlib.h"
+
+typedef struct
+{
+    volatile uint32_t fifo;
+} adc_hw_t;
+
+extern adc_hw_t adc_hw_inst;
+#define adc_hw (&adc_hw_inst)
+
+// Conversões vêm do roteiro de cada entrada (host_adc_script).
+void adc_init(void);
+void adc_gpio_init(unsigned int gpio);
+void adc_select_input(unsigned int input);
+void adc_set_round_robin(unsigned int input_mask);
+void adc_fifo_setup(bool en, bool dreq_en, uint16_t dreq_thresh, bool err_in_fifo, bool byte_shift);
+void adc_set_clkdiv(float clkdiv);
+void adc_run(bool run);
+uint16_t adc_read(void);
+
+#endif // HOST_HARDWARE_ADC_H
@@ -0,0 +1,22 @@
+#ifndef HOST_HARDWARE_CLOCKS_H
+#define HOST_HARDWARE_CLOCKS_H
+
+#include "pico/stdlib.h"
+
+enum clock_index
+{
+    clk_gpout0 = 0,
+    clk_ref = 4,
+    clk_sys = 5,
+    clk_peri = 6,
+    clk_usb = 7,
+    clk_adc = 8,
+};
+
+// Frequência nominal do RP2040, usada nas conversões para ciclos.
+static inline uint32_t clock_get_hz(enum clock_index clk)
+{
+    return clk == clk_sys ? 125000000u : 48000000u;
+}
+
+#endif // HOST_HARDWARE_CLOCKS_H
@@ -0,0 +1,69 @@
+#ifndef HOST_HARDWARE_DMA_H
+#define HOST_HARDWARE_DMA_H
+
+#include "pico/stdlib.h"
+
+// DMA emulado: uma transferência disparada é feita na hora, registrando o
+// que for escrito no I2C, na PIO ou na UART; o canal que lê o FIFO do ADC
+// avança com host_adc_advance(). O fim gera a interrupção do canal.
+#define NUM_DMA_CHANNELS 12
+
+enum dma_channel_transfer_size
+{
+    DMA_SIZE_8 = 0,
+    DMA_SIZE_16 = 1,
+    DMA_SIZE_32 = 2
+};
+
+enum
+{
+    DREQ_PIO0_TX0 = 0,
+    DREQ_PIO1_TX0 = 8,
+    DREQ_UART0_TX = 20,
+    DREQ_I2C0_TX = 32,
+    DREQ_I2C1_TX = 34,
+    DREQ_ADC = 36,
+    DREQ_FORCE = 63,
+};
+
+typedef struct
+{
+    uint8_t size;
+    bool read_increment;
+    bool write_increment;
+    bool ring_write;
+    uint8_t ring_bits;
+    uint8_t dreq;
+} dma_channel_config;
+
+typedef struct
+{
+    volatile uint32_t read_addr;
+    volatile uint32_t write_addr;
+    volatile uint32_t transfer_count;
+    volatile uint32_t ctrl_trig;
+} dma_channel_hw_t;
+
+int dma_claim_unused_channel(bool required);
+dma_channel_config dma_channel_get_default_config(unsigned int channel);
+void channel_config_set_transfer_data_size(dma_channel_config *c, enum dma_channel_transfer_size size);
+void channel_config_set_read_increment(dma_channel_config *c, bool incr);
+void channel_config_set_write_increment(dma_channel_config *c, bool incr);
+void channel_config_set_ring(dma_channel_config *c, bool write, unsigned int size_bits);
+void channel_config_set_dreq(dma_channel_config *c, unsigned int dreq);
+void dma_channel_configure(unsigned int channel, const dma_channel_config *config, volatile void *write_addr,
+                           const volatile void *read_addr, unsigned int transfer_count, bool trigger);
+void dma_channel_transfer_from_buffer_now(unsigned int channel, const volatile void *read_addr,
+                                          uint32_t transfer_count);
+void dma_channel_set_trans_count(unsigned int channel, uint32_t trans_count, bool trigger);
+void dma_channel_abort(unsigned int channel);
+bool dma_channel_is_busy(unsigned int channel);
+dma_channel_hw_t *dma_channel_hw_addr(unsigned int channel);
+void dma_channel_set_irq0_enabled(unsigned int channel, bool enabled);
+void dma_channel_set_irq1_enabled(unsigned int channel, bool enabled);
+bool dma_channel_get_irq0_status(unsigned int channel);
+bool dma_channel_get_irq1_status(unsigned int channel);
+void dma_channel_acknowledge_irq0(unsigned int channel);
+void dma_channel_acknowledge_irq1(unsigned int channel);
+
+#endif // HOST_HARDWARE_DMA_H
@@ -0,0 +1,41 @@
+#ifndef HOST_HARDWARE_GPIO_H
+#define HOST_HARDWARE_GPIO_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define GPIO_OUT 1
+#define GPIO_IN 0
+#define GPIO_IRQ_LEVEL_LOW 0x1u
+#define GPIO_IRQ_LEVEL_HIGH 0x2u
+#define GPIO_IRQ_EDGE_FALL 0x4u
+#define GPIO_IRQ_EDGE_RISE 0x8u
+#define NUM_BANK0_GPIOS 30
+
+enum gpio_function
+{
+    GPIO_FUNC_XIP = 0,
+    GPIO_FUNC_SPI = 1,
+    GPIO_FUNC_UART = 2,
+    GPIO_FUNC_I2C = 3,
+    GPIO_FUNC_PWM = 4,
+    GPIO_FUNC_SIO = 5,
+    GPIO_FUNC_PIO0 = 6,
+    GPIO_FUNC_PIO1 = 7,
+    GPIO_FUNC_NULL = 0x1f,
+};
+
+typedef void (*gpio_irq_callback_t)(unsigned int gpio, uint32_t events);
+
+// Saídas registradas como bordas (pino, nível, instante) em host_hal.h.
+void gpio_init(unsigned int gpio);
+void gpio_set_dir(unsigned int gpio, bool out);
+void gpio_pull_up(unsigned int gpio);
+void gpio_put(unsigned int gpio, bool value);
+bool gpio_get(unsigned int gpio);
+void gpio_set_function(unsigned int gpio, enum gpio_function fn);
+void gpio_set_irq_enabled(unsigned int gpio, uint32_t events, bool enabled);
+void gpio_set_irq_enabled_with_callback(unsigned int gpio, uint32_t events, bool enabled,
+                                        gpio_irq_callback_t callback);
+
+#endif // HOST_HARDWARE_GPIO_H
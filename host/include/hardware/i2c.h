@@ -0,0 +1,46 @@
+#ifndef HOST_HARDWARE_I2C_H
+#define HOST_HARDWARE_I2C_H
+
+#include "pico/stdlib.h"
+
+#define I2C_IC_DATA_CMD_STOP_BITS 0x00000200u
+#define I2C_IC_RAW_INTR_STAT_TX_ABRT_BITS 0x00000040u
+#define I2C_IC_STATUS_TFE_BITS 0x00000004u
+#define I2C_IC_STATUS_MST_ACTIVITY_BITS 0x00000020u
+
+typedef struct
+{
+    volatile uint32_t enable;
+    volatile uint32_t tar;
+    volatile uint32_t data_cmd;
+    volatile uint32_t raw_intr_stat;
+    volatile uint32_t clr_tx_abrt;
+    volatile uint32_t status;
+    volatile uint32_t txflr;
+    volatile uint32_t fs_scl_hcnt;
+    volatile uint32_t fs_scl_lcnt;
+} i2c_hw_t;
+
+typedef struct i2c_inst
+{
+    i2c_hw_t hw;
+    uint8_t index;
+} i2c_inst_t;
+
+extern i2c_inst_t i2c0_inst, i2c1_inst;
+#define i2c0 (&i2c0_inst)
+#define i2c1 (&i2c1_inst)
+
+// Bytes escritos (por DMA ou blocking) são registrados com o endereço do escravo.
+unsigned int i2c_init(i2c_inst_t *i2c, unsigned int baudrate);
+int i2c_write_blocking(i2c_inst_t *i2c, uint8_t addr, const uint8_t *src, size_t len, bool nostop);
+static inline i2c_hw_t *i2c_get_hw(i2c_inst_t *i2c)
+{
+    return &i2c->hw;
+}
+static inline unsigned int i2c_get_dreq(i2c_inst_t *i2c, bool is_tx)
+{
+    return (i2c->index ? 34 : 32) + (is_tx ? 0 : 1);
+}
+
+#endif // HOST_HARDWARE_I2C_H
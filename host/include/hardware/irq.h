@@ -0,0 +1,24 @@
+#ifndef HOST_HARDWARE_IRQ_H
+#define HOST_HARDWARE_IRQ_H
+
+#include "pico/stdlib.h"
+
+typedef void (*irq_handler_t)(void);
+
+enum irq_num
+{
+    TIMER_IRQ_0 = 0,
+    DMA_IRQ_0 = 11,
+    DMA_IRQ_1 = 12,
+    UART0_IRQ = 20,
+    UART1_IRQ = 21,
+    NUM_IRQS = 32,
+};
+
+#define PICO_SHARED_IRQ_HANDLER_DEFAULT_ORDER_PRIORITY 0x80
+
+void irq_set_exclusive_handler(unsigned int num, irq_handler_t handler);
+void irq_add_shared_handler(unsigned int num, irq_handler_t handler, uint8_t order_priority);
+void irq_set_enabled(unsigned int num, bool enabled);
+
+#endif // HOST_HARDWARE_IRQ_H
@@ -0,0 +1,57 @@
+#ifndef HOST_HARDWARE_PIO_H
+#define HOST_HARDWARE_PIO_H
+
+#include "pico/stdlib.h"
+
+typedef struct
+{
+    volatile uint32_t txf[4];
+    uint8_t index;
+    uint8_t claimed;
+} pio_hw_t;
+
+typedef pio_hw_t *PIO;
+
+typedef struct
+{
+    const uint16_t *instructions;
+    uint8_t length;
+    int8_t origin;
+} pio_program_t;
+
+typedef struct
+{
+    uint32_t offset;
+} pio_sm_config;
+
+enum pio_fifo_join
+{
+    PIO_FIFO_JOIN_NONE = 0,
+    PIO_FIFO_JOIN_TX = 1,
+    PIO_FIFO_JOIN_RX = 2
+};
+
+extern pio_hw_t pio0_hw, pio1_hw;
+#define pio0 (&pio0_hw)
+#define pio1 (&pio1_hw)
+
+// Palavras escritas no FIFO de TX (por DMA) são registradas por máquina.
+unsigned int pio_add_program(PIO pio, const pio_program_t *program);
+int pio_claim_unused_sm(PIO pio, bool required);
+static inline unsigned int pio_get_dreq(PIO pio, unsigned int sm, bool is_tx)
+{
+    return pio->index * 8 + sm + (is_tx ? 0 : 4);
+}
+static inline void pio_gpio_init(PIO pio, unsigned int pin) {}
+static inline void pio_sm_set_consecutive_pindirs(PIO pio, unsigned int sm, unsigned int pin, unsigned int count,
+                                                  bool is_out) {}
+static inline void sm_config_set_sideset_pins(pio_sm_config *c, unsigned int pin) {}
+static inline void sm_config_set_out_shift(pio_sm_config *c, bool shift_right, bool autopull,
+                                           unsigned int threshold) {}
+static inline void sm_config_set_fifo_join(pio_sm_config *c, enum pio_fifo_join join) {}
+static inline void sm_config_set_clkdiv(pio_sm_config *c, float div) {}
+static inline void pio_sm_init(PIO pio, unsigned int sm, unsigned int offset, const pio_sm_config *c) {}
+static inline void pio_sm_set_enabled(PIO pio, unsigned int sm, bool enabled) {}
+void pio_sm_put_blocking(PIO pio, unsigned int sm, uint32_t data);
+
+#endif // HOST_HARDWARE_PIO_H
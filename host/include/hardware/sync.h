@@ -0,0 +1,24 @@
+#ifndef HOST_HARDWARE_SYNC_H
+#define HOST_HARDWARE_SYNC_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Um único núcleo emulado: "desabilitar interrupções" adia alarmes e
+// interrupções de DMA até serem reabilitadas.
+typedef volatile uint32_t spin_lock_t;
+
+uint32_t save_and_disable_interrupts(void);
+void restore_interrupts(uint32_t status);
+int spin_lock_claim_unused(bool required);
+spin_lock_t *spin_lock_instance(unsigned int lock_num);
+uint32_t spin_lock_blocking(spin_lock_t *lock);
+void spin_unlock(spin_lock_t *lock, uint32_t saved_irq);
+
+void __wfe(void);
+void __wfi(void);
+void __sev(void);
+#define __dmb() __atomic_thread_fence(__ATOMIC_SEQ_CST)
+#define __compiler_memory_barrier() __asm__ volatile("" ::: "memory")
+
+#endif // HOST_HARDWARE_SYNC_H
@@ -0,0 +1,31 @@
+#ifndef HOST_HARDWARE_UART_H
+#define HOST_HARDWARE_UART_H
+
+#include "pico/stdlib.h"
+
+#define HOST_UART_IDLE 0xFFFFFFFFu
+
+typedef struct
+{
+    volatile uint32_t dr;
+} uart_hw_t;
+
+typedef struct uart_inst
+{
+    uart_hw_t hw;
+    uint8_t index;
+} uart_inst_t;
+
+extern uart_inst_t uart0_inst, uart1_inst;
+#define uart0 (&uart0_inst)
+#define uart1 (&uart1_inst)
+
+// Bytes escritos em dr são registrados na próxima consulta ao periférico.
+bool uart_is_writable(uart_inst_t *uart);
+void uart_set_irq_enables(uart_inst_t *uart, bool rx_has_data, bool tx_needs_data);
+static inline uart_hw_t *uart_get_hw(uart_inst_t *uart)
+{
+    return &uart->hw;
+}
+
+#endif // HOST_HARDWARE_UART_H
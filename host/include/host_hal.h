@@ -0,0 +1,50 @@
+#ifndef HOST_HAL_H
+#define HOST_HAL_H
+
+// Controle do hardware emulado no host: registros do que os drivers
+// escreveram nos periféricos e roteiro das entradas do ADC.
+
+#include "pico/stdlib.h"
+
+typedef struct
+{
+    uint8_t address;
+    uint8_t byte;
+    bool stop; // Último byte da transação
+} host_i2c_event_t;
+
+typedef struct
+{
+    uint8_t pio;
+    uint8_t sm;
+    uint32_t word;
+} host_pio_event_t;
+
+typedef struct
+{
+    uint8_t gpio;
+    bool value;
+    uint64_t time_us;
+} host_gpio_event_t;
+
+// Registro de cada periférico: eventos desde o último host_*_clear.
+const host_i2c_event_t *host_i2c_events(size_t *count);
+const host_pio_event_t *host_pio_events(size_t *count);
+const host_gpio_event_t *host_gpio_events(size_t *count);
+const uint8_t *host_uart_bytes(size_t *count);
+void host_i2c_clear(void);
+void host_pio_clear(void);
+void host_gpio_clear(void);
+void host_uart_clear(void);
+
+// Roteiro do ADC: valor de 12 bits da entrada para a n-ésima conversão dela.
+typedef uint16_t (*host_adc_source_t)(uint8_t input, uint64_t n, void *ctx);
+void host_adc_script(uint8_t input, host_adc_source_t source, void *ctx);
+void host_adc_set_constant(uint8_t input, uint16_t value);
+// Converte count amostras no round-robin, como o DMA do ADC faria.
+void host_adc_advance(uint32_t count);
+
+// Executa alarmes vencidos e interrupções pendentes (se habilitadas).
+void host_poll(void);
+
+#endif // HOST_HAL_H
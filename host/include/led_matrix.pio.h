@@ -0,0 +1,24 @@
+#ifndef HOST_LED_MATRIX_PIO_H
+#define HOST_LED_MATRIX_PIO_H
+
+// Substitui o cabeçalho gerado pelo pioasm a partir de led_matrix.pio.
+#include "hardware/pio.h"
+
+// As instruções não são executadas no host: apenas o FIFO de TX é registrado.
+static const uint16_t led_matrix_program_instructions[4] = {0};
+
+static const pio_program_t led_matrix_program = {
+    .instructions = led_matrix_program_instructions,
+    .length = 4,
+    .origin = -1,
+};
+
+static inline void led_matrix_program_init(PIO pio, unsigned int sm, unsigned int offset, unsigned int pin,
+                                           float freq)
+{
+    pio_sm_config c = {offset};
+    pio_sm_init(pio, sm, offset, &c);
+    pio_sm_set_enabled(pio, sm, true);
+}
+
+#endif // HOST_LED_MATRIX_PIO_H
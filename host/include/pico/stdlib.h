@@ -0,0 +1,28 @@
+#ifndef HOST_PICO_STDLIB_H
+#define HOST_PICO_STDLIB_H
+
+// Subconjunto do Pico SDK para o build do host: mesmos nomes e assinaturas,
+// implementados em host/hal_host.c. Ver host/include/host_hal.h.
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <stdio.h>
+
+typedef unsigned int uint;
+
+#define count_of(a) (sizeof(a) / sizeof((a)[0]))
+#define __not_in_flash_func(f) f
+#define __time_critical_func(f) f
+#define panic(...) abort()
+#define hard_assert(x) ((void)(x))
+
+#include "pico/time.h"
+#include "hardware/gpio.h"
+#include "hardware/sync.h"
+
+void tight_loop_contents(void);
+bool stdio_init_all(void);
+
+#endif // HOST_PICO_STDLIB_H
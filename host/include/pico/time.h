@@ -0,0 +1,30 @@
+#ifndef HOST_PICO_TIME_H
+#define HOST_PICO_TIME_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Tempo do host (relógio monotônico) e alarmes, disparados como
+// interrupções sempre que o código espera (tight_loop_contents, __wfe, sleep).
+typedef uint64_t absolute_time_t;
+typedef int32_t alarm_id_t;
+typedef int64_t (*alarm_callback_t)(alarm_id_t id, void *user_data);
+
+uint64_t time_us_64(void);
+uint32_t time_us_32(void);
+absolute_time_t get_absolute_time(void);
+uint32_t to_ms_since_boot(absolute_time_t t);
+uint64_t to_us_since_boot(absolute_time_t t);
+absolute_time_t make_timeout_time_us(uint64_t us);
+absolute_time_t make_timeout_time_ms(uint32_t ms);
+absolute_time_t delayed_by_us(absolute_time_t t, uint64_t us);
+absolute_time_t delayed_by_ms(absolute_time_t t, uint32_t ms);
+void sleep_us(uint64_t us);
+void sleep_ms(uint32_t ms);
+void busy_wait_us(uint64_t us);
+bool best_effort_wfe_or_timeout(absolute_time_t timeout);
+alarm_id_t add_alarm_in_us(uint64_t us, alarm_callback_t callback, void *user_data, bool fire_if_past);
+alarm_id_t add_alarm_in_ms(uint32_t ms, alarm_callback_t callback, void *user_data, bool fire_if_past);
+bool cancel_alarm(alarm_id_t id);
+
+#endif // HOST_PICO_TIME_H
@@ -0,0 +1,176 @@
+#include "adc_sampler.h"
+#include "hardware/adc.h"
+#include "hardware/dma.h"
+#include "hardware/irq.h"
+#include "hardware/sync.h"
+#include "hardware/clocks.h"
+
+// Buffer circular escrito pelo DMA; o alinhamento é exigido pelo modo ring.
+static uint16_t ring[ADC_SAMPLER_RING_SIZE] __attribute__((aligned(1u << ADC_SAMPLER_RING_BITS)));
+
+static int dma_chan;
+static uint8_t num_inputs;                            // Entradas no round-robin
+static int8_t input_slot[ADC_SAMPLER_MAX_INPUTS];     // Posição de cada entrada na sequência (-1: fora)
+static volatile uint64_t base_count = 0;              // Amostras das transferências anteriores do DMA
+
+// Sobreamostragem por entrada: 2^log2 amostras somadas, deslocadas à direita
+// por shift. Cada fator 4 de amostras rende 1 bit extra de resolução.
+static uint8_t oversample_log2[ADC_SAMPLER_MAX_INPUTS];
+static uint8_t oversample_shift[ADC_SAMPLER_MAX_INPUTS];
+
+// Fim da transferência (após 2^32 - 1 amostras): reinicia mantendo a contagem.
+static void adc_sampler_dma_irq_handler(void)
+{
+    if (dma_channel_get_irq0_status(dma_chan))
+    {
+        dma_channel_acknowledge_irq0(dma_chan);
+        base_count += UINT32_MAX;
+        dma_channel_set_trans_count(dma_chan, UINT32_MAX, true);
+    }
+}
+
+// Coloca o ADC em round-robin livre sobre as entradas de input_mask, com
+// sample_rate_hz amostras por segundo em cada entrada, e o DMA copiando o
+// FIFO do ADC para o buffer circular. Chamar após adc_init e adc_gpio_init.
+void adc_sampler_init(uint8_t input_mask, uint32_t sample_rate_hz)
+{
+    int8_t first = -1;
+
+    num_inputs = 0;
+    for (uint8_t i = 0; i < ADC_SAMPLER_MAX_INPUTS; ++i)
+    {
+        input_slot[i] = -1;
+        if (input_mask & (1u << i))
+        {
+            if (first < 0)
+                first = i;
+            input_slot[i] = num_inputs++;
+        }
+    }
+    if (num_inputs == 0)
+        return;
+
+    // O round-robin começa na entrada selecionada e segue em ordem crescente.
+    adc_select_input(first);
+    adc_set_round_robin(input_mask);
+    adc_fifo_setup(true, true, 1, false, false);
+    adc_set_clkdiv(48000000.f / (sample_rate_hz * num_inputs) - 1.f); // ADC a 48 MHz
+
+    dma_chan = dma_claim_unused_channel(true);
+    dma_channel_config c = dma_channel_get_default_config(dma_chan);
+    channel_config_set_transfer_data_size(&c, DMA_SIZE_16);
+    channel_config_set_read_increment(&c, false);
+    channel_config_set_write_increment(&c, true);
+    channel_config_set_ring(&c, true, ADC_SAMPLER_RING_BITS);
+    channel_config_set_dreq(&c, DREQ_ADC);
+    dma_channel_configure(dma_chan, &c, ring, &adc_hw->fifo, UINT32_MAX, true);
+
+    dma_channel_set_irq0_enabled(dma_chan, true);
+    irq_add_shared_handler(DMA_IRQ_0, adc_sampler_dma_irq_handler, PICO_SHARED_IRQ_HANDLER_DEFAULT_ORDER_PRIORITY);
+    irq_set_enabled(DMA_IRQ_0, true);
+
+    adc_run(true);
+}
+
+// Total de amostras (todas as entradas) já escritas no buffer circular.
+uint64_t adc_sampler_count()
+{
+    uint32_t irq = save_and_disable_interrupts();
+    uint64_t count = base_count + (UINT32_MAX - dma_channel_hw_addr(dma_chan)->transfer_count);
+    restore_interrupts(irq);
+    return count;
+}
+
+// Copia até count amostras mais recentes de uma entrada, da mais nova para a
+// mais antiga, sem bloquear. Retorna quantas amostras foram copiadas.
+uint adc_sampler_read(uint8_t input, uint16_t *samples, uint count)
+{
+    if (input >= ADC_SAMPLER_MAX_INPUTS || input_slot[input] < 0)
+        return 0;
+
+    uint64_t total = adc_sampler_count();
+    if (total <= (uint64_t)input_slot[input])
+        return 0;
+
+    // Índice global da amostra mais recente desta entrada
+    uint64_t last = total - 1;
+    last -= (last % num_inputs + num_inputs - input_slot[input]) % num_inputs;
+
+    // Limita às amostras existentes que ainda não foram sobrescritas
+    uint available = (uint)(last / num_inputs) + 1;
+    uint history = ADC_SAMPLER_RING_SIZE / num_inputs - 1;
+    if (available > history)
+        available = history;
+    if (count > available)
+        count = available;
+
+    for (uint i = 0; i < count; ++i, last -= num_inputs)
+        samples[i] = ring[last % ADC_SAMPLER_RING_SIZE];
+
+    return count;
+}
+
+// Última amostra de uma entrada (0 se ainda não houver).
+uint16_t adc_sampler_latest(uint8_t input)
+{
+    uint16_t sample = 0;
+    adc_sampler_read(input, &sample, 1);
+    return sample;
+}
+
+// Define quantas amostras (potência de 2, limitada ao histórico do buffer)
+// são somadas para cada leitura decimada da entrada. Ex.: 16 -> 14 bits.
+void adc_sampler_set_oversampling(uint8_t input, uint16_t ratio)
+{
+    if (input >= ADC_SAMPLER_MAX_INPUTS || input_slot[input] < 0)
+        return;
+
+    uint history = ADC_SAMPLER_RING_SIZE / num_inputs - 1;
+    uint8_t log2 = 0;
+    while ((1u << (log2 + 1)) <= ratio && (1u << (log2 + 1)) <= history)
+        log2++;
+
+    oversample_log2[input] = log2;
+    oversample_shift[input] = log2 - log2 / 2; // Mantém log2 / 2 bits extras
+}
+
+// Resolução, em bits, das leituras decimadas da entrada.
+uint8_t adc_sampler_resolution(uint8_t input)
+{
+    if (input >= ADC_SAMPLER_MAX_INPUTS)
+        return ADC_SAMPLER_BITS;
+    return ADC_SAMPLER_BITS + oversample_log2[input] / 2;
+}
+
+// Leitura sobreamostrada e decimada da entrada, apenas com aritmética inteira.
+// Antes de o buffer acumular amostras suficientes, média das disponíveis.
+uint32_t adc_sampler_decimated(uint8_t input)
+{
+    uint16_t samples[ADC_SAMPLER_RING_SIZE];
+    uint ratio = 1u << oversample_log2[input];
+    uint count = adc_sampler_read(input, samples, ratio);
+    uint32_t sum = 0;
+
+    for (uint i = 0; i < count; ++i)
+        sum += samples[i];
+
+    if (count == ratio)
+        return sum >> oversample_shift[input];
+    if (count == 0)
+        return 0;
+    return (sum << (oversample_log2[input] / 2)) / count;
+}
+
+// Custo médio, em ciclos de clk_sys, de uma leitura decimada da entrada.
+uint32_t adc_sampler_decimation_cycles(uint8_t input, uint iterations)
+{
+    volatile uint32_t sink;
+    uint32_t start_us = time_us_32();
+
+    for (uint i = 0; i < iterations; ++i)
+        sink = adc_sampler_decimated(input);
+    (void)sink;
+
+    uint64_t elapsed_us = time_us_32() - start_us;
+    return (uint32_t)(elapsed_us * (clock_get_hz(clk_sys) / 1000000) / iterations);
+}
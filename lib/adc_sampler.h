@@ -0,0 +1,22 @@
+#ifndef ADC_SAMPLER_H
+#define ADC_SAMPLER_H
+
+#include "pico/stdlib.h"
+
+// Amostras no buffer circular (potência de 2; o DMA usa o modo ring).
+#define ADC_SAMPLER_RING_BITS 9 // 2^9 bytes = 256 amostras de 16 bits
+#define ADC_SAMPLER_RING_SIZE ((1u << ADC_SAMPLER_RING_BITS) / sizeof(uint16_t))
+#define ADC_SAMPLER_MAX_INPUTS 5
+#define ADC_SAMPLER_BITS 12 // Resolução nativa do ADC
+
+void adc_sampler_init(uint8_t input_mask, uint32_t sample_rate_hz);
+uint16_t adc_sampler_latest(uint8_t input);
+uint adc_sampler_read(uint8_t input, uint16_t *samples, uint count);
+uint64_t adc_sampler_count();
+
+void adc_sampler_set_oversampling(uint8_t input, uint16_t ratio);
+uint32_t adc_sampler_decimated(uint8_t input);
+uint8_t adc_sampler_resolution(uint8_t input);
+uint32_t adc_sampler_decimation_cycles(uint8_t input, uint iterations);
+
+#endif // ADC_SAMPLER_H
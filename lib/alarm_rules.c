@@ -0,0 +1,169 @@
+#include "alarm_rules.h"
+#include "hardware/sync.h"
+
+static const alarm_rule_t *rules;
+static alarm_rule_state_t *states;
+static uint8_t rule_count;
+static const alarm_action_t *actions;
+static uint8_t *action_refs; // Regras ativas sobre cada ação
+static uint8_t action_count;
+
+// Pool fixo de temporizadores: cada slot encerra a ação de uma regra.
+static struct
+{
+    alarm_id_t id;
+    int16_t rule; // -1: slot livre
+} timer_pool[ALARM_TIMER_POOL_SIZE];
+
+static inline uint32_t now_ms()
+{
+    return to_ms_since_boot(get_absolute_time());
+}
+
+// Associa as tabelas de regras, estados e ações ao motor.
+void alarm_rules_init(const alarm_rule_t *rule_table, alarm_rule_state_t *state_table, uint8_t count,
+                      const alarm_action_t *action_table, uint8_t *refs, uint8_t actions_len)
+{
+    rules = rule_table;
+    states = state_table;
+    rule_count = count;
+    actions = action_table;
+    action_refs = refs;
+    action_count = actions_len;
+
+    for (uint8_t i = 0; i < actions_len; ++i)
+        action_refs[i] = 0;
+    for (uint8_t i = 0; i < count; ++i)
+    {
+        states[i].state = ALARM_STATE_IDLE;
+        states[i].count = 0;
+        states[i].timer = -1;
+        states[i].since_ms = 0;
+        states[i].fired = 0;
+    }
+    for (uint8_t i = 0; i < ALARM_TIMER_POOL_SIZE; ++i)
+        timer_pool[i].rule = -1;
+}
+
+// Encerra a ação da regra e entra em cooldown (ou volta a ociosa).
+// Chamar com interrupções desabilitadas.
+static void alarm_rule_finish(uint8_t index, uint32_t now)
+{
+    const alarm_rule_t *rule = &rules[index];
+    alarm_rule_state_t *state = &states[index];
+    const alarm_action_t *action = &actions[rule->action];
+
+    if (state->timer >= 0)
+    {
+        cancel_alarm(timer_pool[state->timer].id);
+        timer_pool[state->timer].rule = -1;
+        state->timer = -1;
+    }
+
+    if (--action_refs[rule->action] == 0 && action->stop != NULL)
+        action->stop(action->arg);
+
+    state->state = rule->cooldown_ms > 0 ? ALARM_STATE_COOLDOWN : ALARM_STATE_IDLE;
+    state->count = 0;
+    state->since_ms = now;
+}
+
+// Fim da duração de uma ação: libera o slot e encerra a regra.
+static int64_t alarm_rule_timer_callback(alarm_id_t id, void *user_data)
+{
+    int8_t slot = (int8_t)(intptr_t)user_data;
+    int16_t index = timer_pool[slot].rule;
+
+    if (index >= 0 && states[index].timer == slot)
+    {
+        states[index].timer = -1;
+        timer_pool[slot].rule = -1;
+        alarm_rule_finish(index, now_ms());
+    }
+    return 0;
+}
+
+// Dispara a ação da regra e, se ela tiver duração, agenda o término em um
+// slot do pool. Sem slot livre, o término é feito pela própria avaliação.
+static void alarm_rule_fire(uint8_t index, uint32_t now)
+{
+    const alarm_rule_t *rule = &rules[index];
+    alarm_rule_state_t *state = &states[index];
+    const alarm_action_t *action = &actions[rule->action];
+
+    state->state = ALARM_STATE_ACTIVE;
+    state->since_ms = now;
+    state->fired++;
+
+    if (action_refs[rule->action]++ == 0 && action->start != NULL)
+        action->start(action->arg);
+
+    if (rule->duration_ms == 0)
+        return;
+
+    for (int8_t slot = 0; slot < ALARM_TIMER_POOL_SIZE; ++slot)
+    {
+        if (timer_pool[slot].rule < 0)
+        {
+            alarm_id_t id = add_alarm_in_ms(rule->duration_ms, alarm_rule_timer_callback, (void *)(intptr_t)slot, false);
+            if (id > 0)
+            {
+                timer_pool[slot].id = id;
+                timer_pool[slot].rule = index;
+                state->timer = slot;
+            }
+            return;
+        }
+    }
+}
+
+// Avalia todas as regras em uma única passada, O(regras), com as leituras
+// atuais: metrics[métrica] é o vetor daquela métrica, indexado pelo ambiente.
+// Executa com interrupções desabilitadas para não competir com os
+// temporizadores do pool pelo estado das regras e das ações.
+void alarm_rules_evaluate(const centi_t *const metrics[ALARM_METRIC_COUNT])
+{
+    uint32_t now = now_ms();
+    uint32_t irq = save_and_disable_interrupts();
+
+    for (uint8_t i = 0; i < rule_count; ++i)
+    {
+        const alarm_rule_t *rule = &rules[i];
+        alarm_rule_state_t *state = &states[i];
+        centi_t value = metrics[rule->metric][rule->room];
+        bool below = rule->comparator == ALARM_BELOW;
+        bool triggered = below ? value < rule->threshold : value > rule->threshold;
+        bool released = below ? value > rule->threshold + rule->hysteresis
+                              : value < rule->threshold - rule->hysteresis;
+
+        switch (state->state)
+        {
+        case ALARM_STATE_IDLE:
+            if (triggered)
+            {
+                if (++state->count >= rule->debounce)
+                    alarm_rule_fire(i, now);
+            }
+            else if (released)
+            {
+                state->count = 0; // Dentro da faixa de histerese a contagem é mantida
+            }
+            break;
+
+        case ALARM_STATE_ACTIVE:
+            if (rule->duration_ms == 0 ? released : now - state->since_ms >= rule->duration_ms)
+                alarm_rule_finish(i, now);
+            break;
+
+        case ALARM_STATE_COOLDOWN:
+            if (now - state->since_ms >= rule->cooldown_ms)
+            {
+                state->state = ALARM_STATE_IDLE;
+                state->count = 0;
+            }
+            break;
+        }
+    }
+
+    restore_interrupts(irq);
+}
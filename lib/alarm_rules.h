@@ -0,0 +1,65 @@
+#ifndef ALARM_RULES_H
+#define ALARM_RULES_H
+
+#include "pico/stdlib.h"
+#include "fixed_point.h"
+
+#define ALARM_TIMER_POOL_SIZE 8 // Temporizadores para ações com duração
+
+typedef enum
+{
+    ALARM_METRIC_TEMPERATURE,
+    ALARM_METRIC_HUMIDITY,
+    ALARM_METRIC_COUNT
+} alarm_metric_t;
+
+typedef enum
+{
+    ALARM_BELOW, // Dispara com valor < limiar; libera com valor > limiar + histerese
+    ALARM_ABOVE  // Dispara com valor > limiar; libera com valor < limiar - histerese
+} alarm_comparator_t;
+
+// Ação acionada por uma ou mais regras. Com várias regras ativas sobre a
+// mesma ação, start é chamado na primeira e stop na última a terminar.
+typedef struct
+{
+    void (*start)(uint32_t arg);
+    void (*stop)(uint32_t arg);
+    uint32_t arg;
+} alarm_action_t;
+
+typedef struct
+{
+    uint8_t room;
+    uint8_t metric;       // alarm_metric_t
+    uint8_t comparator;   // alarm_comparator_t
+    uint8_t debounce;     // Amostras consecutivas para disparar
+    centi_t threshold;
+    centi_t hysteresis;
+    uint8_t action;       // Índice na tabela de ações
+    uint32_t duration_ms; // 0: ativa enquanto a condição durar
+    uint32_t cooldown_ms; // Tempo sem disparar após terminar
+} alarm_rule_t;
+
+typedef enum
+{
+    ALARM_STATE_IDLE,
+    ALARM_STATE_ACTIVE,
+    ALARM_STATE_COOLDOWN
+} alarm_state_t;
+
+// Estado explícito de cada regra, em tabela paralela à de regras.
+typedef struct
+{
+    uint8_t state;    // alarm_state_t
+    uint8_t count;    // Amostras consecutivas na condição de disparo
+    int8_t timer;     // Slot do temporizador da duração (-1: nenhum)
+    uint32_t since_ms; // Início do estado atual
+    uint32_t fired;    // Disparos desde o boot
+} alarm_rule_state_t;
+
+void alarm_rules_init(const alarm_rule_t *rules, alarm_rule_state_t *states, uint8_t count,
+                      const alarm_action_t *actions, uint8_t *action_refs, uint8_t action_count);
+void alarm_rules_evaluate(const centi_t *const metrics[ALARM_METRIC_COUNT]);
+
+#endif // ALARM_RULES_H
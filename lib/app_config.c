@@ -0,0 +1,22 @@
+#include "app_config.h"
+
+// Monta a tabela de regras: para cada ambiente, buzzer A com frio extremo,
+// buzzer B com calor extremo e câmera com temperatura alta. As regras ficam
+// agrupadas por tipo e, dentro do grupo, na ordem dos ambientes, para que a
+// avaliação percorra o vetor de cada métrica sequencialmente.
+void build_alarm_rules(alarm_rule_t rules[NUM_RULES])
+{
+    alarm_rule_t *cold = &rules[0];
+    alarm_rule_t *hot = &rules[NUM_ROOM];
+    alarm_rule_t *camera = &rules[2 * NUM_ROOM];
+
+    for (int i = 0; i < NUM_ROOM; i++)
+    {
+        cold[i] = (alarm_rule_t){i, ALARM_METRIC_TEMPERATURE, ALARM_BELOW, ALARM_DEBOUNCE, CENTI(7),
+                                 ALARM_HYSTERESIS, ACTION_BUZZER_A, ALARM_DURATION, ALARM_DELAY};
+        hot[i] = (alarm_rule_t){i, ALARM_METRIC_TEMPERATURE, ALARM_ABOVE, ALARM_DEBOUNCE, CENTI(44),
+                                ALARM_HYSTERESIS, ACTION_BUZZER_B, ALARM_DURATION, ALARM_DELAY};
+        camera[i] = (alarm_rule_t){i, ALARM_METRIC_TEMPERATURE, ALARM_ABOVE, 1, CENTI(37),
+                                   ALARM_HYSTERESIS, ACTION_CAMERA + i, 0, 0};
+    }
+}
@@ -0,0 +1,33 @@
+#ifndef APP_CONFIG_H
+#define APP_CONFIG_H
+
+// Configuração da aplicação compartilhada entre o firmware (main.c) e o
+// benchmark do host (host/bench.c), para que os dois meçam o mesmo sistema.
+
+#include "pico/stdlib.h"
+#include "fixed_point.h"
+#include "alarm_rules.h"
+
+#define I2C_ADDRESS 0x3C
+#define LED_MATRIX_PIN 7
+#define ADC_VRX_INPUT 1 // GPIO 27
+#define ADC_VRY_INPUT 0 // GPIO 26
+#define ADC_SAMPLE_RATE_HZ 1000 // Amostras por segundo em cada entrada
+#define ADC_OVERSAMPLE_RATIO 16 // Amostras por leitura: 16x -> 14 bits
+#define MAX_TEMP 62
+#define NUM_ROOM 32 // Ambientes instalados (até ROOM_STORE_CAPACITY)
+#define ALARM_DURATION 5000
+#define ALARM_DELAY 5000 // 3600000
+#define ALARM_HYSTERESIS CENTI(1) // Faixa para liberar uma regra após o disparo
+#define ALARM_DEBOUNCE 2 // Amostras consecutivas para disparar um alarme
+#define RULES_PER_ROOM 3
+#define NUM_RULES (NUM_ROOM * RULES_PER_ROOM)
+#define CHART_HEIGHT 20 // Altura de cada gráfico, em pixels
+
+// Ações acionadas pelas regras de alarme: os dois buzzers e a câmera de cada ambiente
+enum { ACTION_BUZZER_A, ACTION_BUZZER_B, ACTION_CAMERA };
+#define NUM_ACTIONS (ACTION_CAMERA + NUM_ROOM)
+
+void build_alarm_rules(alarm_rule_t rules[NUM_RULES]);
+
+#endif // APP_CONFIG_H
@@ -0,0 +1,120 @@
+#include <assert.h>
+#include "buzzer.h"
+#include "hardware/dma.h"
+#include "hardware/sync.h"
+
+static uint tick_dreq;
+static uint32_t wait_sink; // Destino e origem das transferências de espera
+
+// Configura o slice de PWM que marca o tempo dos padrões: sem pino, apenas o
+// wrap a cada BUZZER_TICK_MS, que cadencia as esperas de todos os buzzers.
+void buzzer_clock_init(uint slice)
+{
+    static_assert(BUZZER_TICK_DIV <= 255 && BUZZER_TICK_TOP <= 0xFFFF, "BUZZER_TICK_MS longo demais para o PWM");
+    hard_assert(clock_get_hz(clk_sys) == BUZZER_CLOCK_HZ); // As notas foram calculadas para este clock
+
+    pwm_config config = pwm_get_default_config();
+    pwm_config_set_clkdiv_int(&config, BUZZER_TICK_DIV);
+    pwm_config_set_wrap(&config, BUZZER_TICK_TOP);
+    pwm_init(slice, &config, true);
+    tick_dreq = pwm_get_dreq(slice);
+}
+
+// Prepara o pino e reserva os dois canais de DMA do sequenciador.
+void buzzer_init(buzzer_t *buzzer, uint pin)
+{
+    buzzer->pin = pin;
+    buzzer->slice = pwm_gpio_to_slice_num(pin);
+    buzzer->pattern = NULL;
+    buzzer->first = buzzer->blocks;
+
+    gpio_set_function(pin, GPIO_FUNC_PWM);
+    pwm_config config = pwm_get_default_config();
+    pwm_init(buzzer->slice, &config, true);
+    pwm_set_gpio_level(pin, 0); // Desliga o PWM inicialmente
+
+    buzzer->data_chan = dma_claim_unused_channel(true);
+    buzzer->ctrl_chan = dma_claim_unused_channel(true);
+
+    // Canal de controle: 4 palavras por bloco nos registradores do alias 0 do
+    // canal de dados (anel de 16 bytes na escrita); a última dispara o bloco.
+    dma_channel_config c = dma_channel_get_default_config(buzzer->ctrl_chan);
+    channel_config_set_transfer_data_size(&c, DMA_SIZE_32);
+    channel_config_set_read_increment(&c, true);
+    channel_config_set_write_increment(&c, true);
+    channel_config_set_ring(&c, true, 4);
+    dma_channel_configure(buzzer->ctrl_chan, &c, &dma_channel_hw_addr(buzzer->data_chan)->read_addr, buzzer->blocks,
+                          4, false);
+}
+
+// Palavra CTRL do canal de dados para um tipo de bloco
+static uint32_t buzzer_data_ctrl(const buzzer_t *buzzer, bool increment, uint dreq, bool chain)
+{
+    dma_channel_config c = dma_channel_get_default_config(buzzer->data_chan);
+    channel_config_set_transfer_data_size(&c, DMA_SIZE_32);
+    channel_config_set_read_increment(&c, increment);
+    channel_config_set_write_increment(&c, increment);
+    channel_config_set_dreq(&c, dreq);
+    channel_config_set_chain_to(&c, chain ? buzzer->ctrl_chan : buzzer->data_chan); // Para si mesmo: sem encadear
+    return channel_config_get_ctrl_value(&c);
+}
+
+// Para os dois canais juntos, para que um não redispare o outro.
+static void buzzer_abort(buzzer_t *buzzer)
+{
+    uint32_t mask = (1u << buzzer->data_chan) | (1u << buzzer->ctrl_chan);
+    dma_hw->abort = mask;
+    while (dma_hw->abort & mask)
+        tight_loop_contents();
+}
+
+// Começa um padrão, interrompendo o anterior. Os blocos e as notas são
+// copiados aqui para a RAM, uma vez por padrão; daí em diante o DMA toca e
+// repete sem a CPU e sem ler a flash.
+void buzzer_play(buzzer_t *buzzer, const buzzer_pattern_t *pattern)
+{
+    volatile void *slice_regs = &pwm_hw->slice[buzzer->slice].div;
+    uint32_t set_ctrl = buzzer_data_ctrl(buzzer, true, DREQ_FORCE, true);
+    uint32_t wait_ctrl = buzzer_data_ctrl(buzzer, false, tick_dreq, true);
+    buzzer_block_t *block = buzzer->blocks;
+
+    uint32_t irq = save_and_disable_interrupts();
+    buzzer_abort(buzzer);
+
+    for (uint8_t i = 0; i < pattern->count; ++i)
+    {
+        const buzzer_step_t *step = &pattern->steps[i];
+        buzzer->tones[i] = step->tone;
+        *block++ = (buzzer_block_t){&buzzer->tones[i], slice_regs, 4, set_ctrl};
+        *block++ = (buzzer_block_t){&wait_sink, &wait_sink, step->ticks, wait_ctrl};
+    }
+
+    if (pattern->loop)
+    {
+        // Reescreve o endereço de leitura do canal de controle, o que o redispara no primeiro bloco
+        *block++ = (buzzer_block_t){&buzzer->first, &dma_channel_hw_addr(buzzer->ctrl_chan)->al3_read_addr_trig, 1,
+                                    buzzer_data_ctrl(buzzer, false, DREQ_FORCE, false)};
+    }
+    else
+    {
+        buzzer->tones[pattern->count] = (buzzer_tone_t)BUZZER_SILENCE;
+        *block++ = (buzzer_block_t){&buzzer->tones[pattern->count], slice_regs, 4, set_ctrl};
+        *block++ = (buzzer_block_t){NULL, NULL, 0, 0}; // Gatilho nulo: fim da sequência
+    }
+
+    // A interrupção pode ter parado o canal de controle no meio de um bloco
+    buzzer->pattern = pattern;
+    dma_channel_set_write_addr(buzzer->ctrl_chan, &dma_channel_hw_addr(buzzer->data_chan)->read_addr, false);
+    dma_channel_set_read_addr(buzzer->ctrl_chan, buzzer->blocks, true);
+    restore_interrupts(irq);
+}
+
+// Interrompe o padrão em andamento e silencia o buzzer.
+void buzzer_stop(buzzer_t *buzzer)
+{
+    uint32_t irq = save_and_disable_interrupts();
+    buzzer_abort(buzzer);
+    pwm_set_gpio_level(buzzer->pin, 0);
+    buzzer->pattern = NULL;
+    restore_interrupts(irq);
+}
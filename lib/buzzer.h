@@ -0,0 +1,116 @@
+#ifndef BUZZER_H
+#define BUZZER_H
+
+#include "pico/stdlib.h"
+#include "hardware/pwm.h"
+#include "hardware/clocks.h"
+
+// Clock do sistema para o qual as tabelas de notas são calculadas: o mesmo
+// configurado no SDK (conferido em buzzer_clock_init, também em release).
+#ifndef BUZZER_CLOCK_HZ
+#if defined(SYS_CLK_HZ)
+#define BUZZER_CLOCK_HZ SYS_CLK_HZ
+#elif defined(SYS_CLK_KHZ)
+#define BUZZER_CLOCK_HZ (SYS_CLK_KHZ * 1000u)
+#else
+#define BUZZER_CLOCK_HZ 125000000u
+#endif
+#endif
+
+// Passo de tempo dos padrões: período do slice de PWM que cadencia o DMA.
+#define BUZZER_TICK_MS 10
+#define BUZZER_TICK_CYCLES ((uint64_t)BUZZER_CLOCK_HZ * BUZZER_TICK_MS / 1000)
+#define BUZZER_TICK_DIV ((BUZZER_TICK_CYCLES + 0xFFFF) / 0x10000)
+#define BUZZER_TICK_TOP (BUZZER_TICK_CYCLES / BUZZER_TICK_DIV - 1)
+
+#define BUZZER_PATTERN_MAX_STEPS 8
+
+// Registradores de um slice do PWM, na ordem do hardware (DIV, CTR, CC, TOP):
+// uma nota é escrita pelo DMA em uma única rajada de 4 palavras.
+typedef struct
+{
+    uint32_t div;
+    uint32_t ctr;
+    uint32_t cc;
+    uint32_t top;
+} buzzer_tone_t;
+
+// Divisor inteiro e wrap de cada nota, calculados na compilação: o menor
+// divisor que deixa o wrap em 16 bits dá a maior resolução de frequência
+// (erro abaixo de 0,01% de 8 Hz a 20 kHz).
+#define BUZZER_TONE_DIV(freq) (((uint64_t)BUZZER_CLOCK_HZ + (freq) * 0x10000ull - 1) / ((freq) * 0x10000ull))
+#define BUZZER_TONE_TOP(freq) \
+    (((uint64_t)BUZZER_CLOCK_HZ + BUZZER_TONE_DIV(freq) * (freq) / 2) / (BUZZER_TONE_DIV(freq) * (freq)) - 1)
+// Duty de 50% nos dois canais do slice (só o pino do buzzer está no PWM)
+#define BUZZER_TONE(freq)                                                                              \
+    {                                                                                                  \
+        .div = (uint32_t)BUZZER_TONE_DIV(freq) << PWM_CH0_DIV_INT_LSB, .ctr = 0,                       \
+        .cc = (uint32_t)(BUZZER_TONE_TOP(freq) / 2) * 0x10001u, .top = (uint32_t)BUZZER_TONE_TOP(freq) \
+    }
+#define BUZZER_SILENCE { .div = 1u << PWM_CH0_DIV_INT_LSB, .ctr = 0, .cc = 0, .top = 0xFFFF }
+
+#define BUZZER_TICKS(ms) ((ms) < BUZZER_TICK_MS ? 1 : ((ms) + BUZZER_TICK_MS / 2) / BUZZER_TICK_MS)
+
+// Passo de um padrão: nota (ou pausa) mantida por ticks períodos de BUZZER_TICK_MS.
+typedef struct
+{
+    buzzer_tone_t tone;
+    uint32_t ticks;
+} buzzer_step_t;
+
+#define BUZZER_NOTE(freq, ms) { BUZZER_TONE(freq), BUZZER_TICKS(ms) }
+#define BUZZER_PAUSE(ms) { BUZZER_SILENCE, BUZZER_TICKS(ms) }
+
+typedef struct
+{
+    const buzzer_step_t *steps;
+    uint8_t count;
+    bool loop; // true: repete até buzzer_stop; false: silencia ao fim
+} buzzer_pattern_t;
+
+// O array de tamanho negativo rejeita, em tempo de compilação, padrões com
+// mais de BUZZER_PATTERN_MAX_STEPS passos.
+#define BUZZER_PATTERN(step_array, repeat)                                                                 \
+    {                                                                                                      \
+        .steps = (step_array),                                                                             \
+        .count = count_of(step_array) +                                                                    \
+                 0 * sizeof(char[count_of(step_array) <= BUZZER_PATTERN_MAX_STEPS ? 1 : -1]),              \
+        .loop = (repeat)                                                                                   \
+    }
+
+// Bloco de controle: valores para os registradores do canal de dados, na
+// ordem do alias 0 (READ_ADDR, WRITE_ADDR, TRANS_COUNT, CTRL_TRIG).
+typedef struct
+{
+    const volatile void *read_addr;
+    volatile void *write_addr;
+    uint32_t transfer_count;
+    uint32_t ctrl;
+} buzzer_block_t;
+
+// Sequenciador de um buzzer: um canal de controle carrega, bloco a bloco, o
+// canal de dados, que alterna entre escrever uma nota no slice (rajada sem
+// cadência) e esperar a duração (transferências inúteis cadenciadas pelo
+// wrap do slice de tempo). Ao fim de cada bloco o canal de dados dispara o de
+// controle; um padrão em laço termina reapontando o canal de controle para o
+// primeiro bloco. Nenhuma interrupção ou CPU por nota.
+typedef struct
+{
+    uint pin;
+    uint slice;
+    int data_chan;
+    int ctrl_chan;
+    buzzer_block_t blocks[2 * BUZZER_PATTERN_MAX_STEPS + 2];
+    // Cópia em RAM das notas do padrão (+ silêncio final): o DMA nunca lê a
+    // flash, que fica inacessível enquanto o log grava ou apaga um setor
+    buzzer_tone_t tones[BUZZER_PATTERN_MAX_STEPS + 1];
+    const buzzer_block_t *first; // Lido pelo bloco de laço
+    const buzzer_pattern_t *pattern;
+} buzzer_t;
+
+void buzzer_clock_init(uint slice);
+void buzzer_init(buzzer_t *buzzer, uint pin);
+void buzzer_play(buzzer_t *buzzer, const buzzer_pattern_t *pattern);
+void buzzer_stop(buzzer_t *buzzer);
+
+#endif // BUZZER_H
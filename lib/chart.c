@@ -0,0 +1,43 @@
+#include "chart.h"
+
+// Converte os pontos (média de cada agregado) em uma coluna por pixel, com
+// escala automática entre o menor e o maior valor. Com menos pontos que
+// colunas, cada ponto ocupa colunas vizinhas.
+void chart_prepare(chart_series_t *chart, const history_bucket_t *points, uint16_t count, uint8_t width,
+                   uint8_t height)
+{
+    if (width > CHART_MAX_WIDTH)
+        width = CHART_MAX_WIDTH;
+    chart->height = height;
+    chart->width = count > 0 ? width : 0;
+    if (count == 0 || height == 0)
+        return;
+
+    centi_t low = points[0].avg, high = points[0].avg;
+    for (uint16_t i = 1; i < count; ++i)
+    {
+        if (points[i].avg < low)
+            low = points[i].avg;
+        if (points[i].avg > high)
+            high = points[i].avg;
+    }
+    chart->low = low;
+    chart->high = high;
+
+    int32_t range = high > low ? high - low : 1;
+    for (uint8_t col = 0; col < width; ++col)
+    {
+        centi_t value = points[(uint32_t)col * count / width].avg;
+        chart->rows[col] = (height - 1) - (value - low) * (height - 1) / range;
+    }
+}
+
+// Desenha as colunas da base até o valor de cada uma, com (x, y) no canto
+// superior esquerdo. Cada coluna é um ssd1306_vline: bytes inteiros por página.
+void chart_draw(ssd1306_t *ssd, const chart_series_t *chart, uint8_t x, uint8_t y)
+{
+    uint8_t bottom = y + chart->height - 1;
+
+    for (uint8_t col = 0; col < chart->width; ++col)
+        ssd1306_vline(ssd, x + col, y + chart->rows[col], bottom, true);
+}
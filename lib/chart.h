@@ -0,0 +1,24 @@
+#ifndef CHART_H
+#define CHART_H
+
+#include "pico/stdlib.h"
+#include "ssd1306.h"
+#include "history.h"
+
+#define CHART_MAX_WIDTH 128
+
+// Gráfico de colunas já reduzido a um valor por coluna de pixels: desenhar
+// custa O(largura), independente de quantas amostras o período contém.
+typedef struct
+{
+    uint8_t width;                 // Colunas preenchidas (0: sem dados)
+    uint8_t height;
+    uint8_t rows[CHART_MAX_WIDTH]; // Linha do topo de cada coluna (0: topo do gráfico)
+    centi_t low, high;             // Escala vertical (base e topo)
+} chart_series_t;
+
+void chart_prepare(chart_series_t *chart, const history_bucket_t *points, uint16_t count, uint8_t width,
+                   uint8_t height);
+void chart_draw(ssd1306_t *ssd, const chart_series_t *chart, uint8_t x, uint8_t y);
+
+#endif // CHART_H
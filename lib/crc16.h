@@ -0,0 +1,29 @@
+#ifndef CRC16_H
+#define CRC16_H
+
+// CRC-16/CCITT-FALSE (polinômio 0x1021), um nibble por vez. Apenas C padrão:
+// usado pelo firmware e pelas ferramentas do host (tools/).
+
+#include <stdint.h>
+#include <stddef.h>
+
+#define CRC16_INIT 0xFFFF
+
+// Continua o cálculo a partir de crc (CRC16_INIT no início).
+static inline uint16_t crc16_update(uint16_t crc, const void *data, size_t len)
+{
+    static const uint16_t table[16] = {
+        0x0000, 0x1021, 0x2042, 0x3063, 0x4084, 0x50A5, 0x60C6, 0x70E7,
+        0x8108, 0x9129, 0xA14A, 0xB16B, 0xC18C, 0xD1AD, 0xE1CE, 0xF1EF,
+    };
+    const uint8_t *bytes = data;
+
+    for (size_t i = 0; i < len; ++i)
+    {
+        crc = (uint16_t)(crc << 4) ^ table[(crc >> 12) ^ (bytes[i] >> 4)];
+        crc = (uint16_t)(crc << 4) ^ table[(crc >> 12) ^ (bytes[i] & 0x0F)];
+    }
+    return crc;
+}
+
+#endif // CRC16_H
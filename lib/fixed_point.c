@@ -0,0 +1,42 @@
+#include "fixed_point.h"
+
+// Escreve value (em centésimos) com 0 a 2 casas decimais, arredondado e
+// alinhado à direita em width caracteres, sem formatação de ponto flutuante.
+// buffer deve comportar max(width, 13) + 1 bytes. Retorna o comprimento.
+uint8_t fixed_format(char *buffer, centi_t value, uint8_t decimals, uint8_t width)
+{
+    char digits[12];
+    uint8_t len = 0;
+    bool negative = value < 0;
+    uint32_t magnitude = negative ? -(uint32_t)value : (uint32_t)value;
+
+    if (decimals > 2)
+        decimals = 2;
+
+    // Arredonda para a precisão pedida
+    if (decimals == 0)
+        magnitude = (magnitude + 50) / 100;
+    else if (decimals == 1)
+        magnitude = (magnitude + 5) / 10;
+    bool minus = negative && magnitude != 0; // -0.4 arredonda para "0"
+
+    // Dígitos em ordem inversa, com o ponto após as casas decimais
+    uint8_t n = 0;
+    do {
+        if (n == decimals && decimals > 0)
+            digits[n++] = '.';
+        digits[n++] = '0' + magnitude % 10;
+        magnitude /= 10;
+    } while (magnitude > 0 || n <= decimals);
+
+    if (minus)
+        digits[n++] = '-';
+
+    for (uint8_t pad = n; pad < width; ++pad)
+        buffer[len++] = ' ';
+    while (n > 0)
+        buffer[len++] = digits[--n];
+    buffer[len] = '\0';
+
+    return len;
+}
@@ -0,0 +1,21 @@
+#ifndef FIXED_POINT_H
+#define FIXED_POINT_H
+
+#include "pico/stdlib.h"
+
+// Valores em centésimos (centi-graus, centi-porcento) em int32_t: o RP2040
+// não tem FPU, então sensores, limiares e formatação usam apenas inteiros.
+typedef int32_t centi_t;
+
+#define CENTI(x) ((centi_t)((x) * 100))
+
+// Converte uma leitura de bits de resolução para [0, full_scale] em centésimos.
+// raw * full_scale cabe em 32 bits para raw < 2^16 e full_scale até 655 (65500 centi).
+static inline centi_t fixed_from_adc(uint32_t raw, uint8_t bits, uint32_t full_scale)
+{
+    return (centi_t)((raw * (full_scale * 100u)) >> bits);
+}
+
+uint8_t fixed_format(char *buffer, centi_t value, uint8_t decimals, uint8_t width);
+
+#endif // FIXED_POINT_H
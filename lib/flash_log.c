@@ -0,0 +1,214 @@
+#include <string.h>
+#include "flash_log.h"
+#include "crc16.h"
+
+#define SECTOR_MAGIC 0x474F4C46u // "FLOG"
+#define ERASED_LEN 0xFF          // Tamanho de registro em flash apagada: fim da página
+
+static inline void put_u32(uint8_t *p, uint32_t value)
+{
+    p[0] = (uint8_t)value;
+    p[1] = (uint8_t)(value >> 8);
+    p[2] = (uint8_t)(value >> 16);
+    p[3] = (uint8_t)(value >> 24);
+}
+
+static inline uint32_t get_u32(const uint8_t *p)
+{
+    return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static inline uint32_t page_offset(const flash_log_t *log, uint16_t sector, uint16_t page)
+{
+    return (uint32_t)sector * log->dev->sector_size + (uint32_t)page * FLASH_LOG_PAGE_SIZE;
+}
+
+// Sequência de um setor com cabeçalho válido; false se apagado ou inválido.
+static bool sector_header(const flash_log_t *log, uint16_t sector, uint32_t *sector_seq)
+{
+    uint8_t header[FLASH_LOG_SECTOR_HEADER_SIZE];
+
+    if (!log->dev->read(log->dev->ctx, page_offset(log, sector, 0), header, sizeof(header)))
+        return false;
+    if (get_u32(header) != SECTOR_MAGIC)
+        return false;
+    *sector_seq = get_u32(&header[4]);
+    return true;
+}
+
+static bool page_erased(const uint8_t *page)
+{
+    for (uint16_t i = 0; i < FLASH_LOG_PAGE_SIZE; ++i)
+        if (page[i] != 0xFF)
+            return false;
+    return true;
+}
+
+// CRC do registro: tamanho, tipo, sequência e dados.
+static uint16_t record_crc(const uint8_t *record, uint8_t len)
+{
+    uint16_t crc = crc16_update(CRC16_INIT, record, 2);
+    return crc16_update(crc, &record[4], 4 + len);
+}
+
+// Reproduz os registros de uma página gravada. Um registro com CRC inválido
+// (gravação interrompida) encerra a página: o resto dela não é confiável.
+static uint32_t replay_page(flash_log_t *log, const uint8_t *page, uint16_t start, flash_log_replay_t replay,
+                            void *ctx)
+{
+    uint32_t count = 0;
+    uint16_t pos = start;
+
+    while (pos + FLASH_LOG_RECORD_HEADER_SIZE <= FLASH_LOG_PAGE_SIZE && page[pos] != ERASED_LEN)
+    {
+        const uint8_t *record = &page[pos];
+        uint8_t len = record[0];
+        uint32_t seq = get_u32(&record[4]);
+
+        if (pos + FLASH_LOG_RECORD_HEADER_SIZE + len > FLASH_LOG_PAGE_SIZE ||
+            record_crc(record, len) != (record[2] | (record[3] << 8)))
+        {
+            log->records_lost++;
+            break;
+        }
+        if (replay != NULL)
+            replay(ctx, record[1], &record[FLASH_LOG_RECORD_HEADER_SIZE], len, seq);
+        if (seq >= log->seq)
+            log->seq = seq + 1;
+        count++;
+        pos += FLASH_LOG_RECORD_HEADER_SIZE + len;
+    }
+    return count;
+}
+
+// Varre a região: encontra o setor mais recente e a próxima página livre e
+// reproduz todos os registros válidos, do mais antigo ao mais recente.
+// Retorna o número de registros reproduzidos.
+uint32_t flash_log_mount(flash_log_t *log, const flash_log_dev_t *dev, flash_log_replay_t replay, void *ctx)
+{
+    uint8_t page[FLASH_LOG_PAGE_SIZE];
+    uint32_t count = 0;
+    bool found = false;
+
+    memset(log, 0, sizeof(*log));
+    log->dev = dev;
+    log->sectors = dev->size / dev->sector_size;
+    log->pages_per_sector = dev->sector_size / FLASH_LOG_PAGE_SIZE;
+
+    // Setor mais recente: maior sequência de setor
+    for (uint16_t s = 0; s < log->sectors; ++s)
+    {
+        uint32_t sector_seq;
+        if (sector_header(log, s, &sector_seq) && (!found || (int32_t)(sector_seq - log->sector_seq) > 0))
+        {
+            found = true;
+            log->sector = s;
+            log->sector_seq = sector_seq;
+        }
+    }
+
+    if (!found)
+    {
+        // Região nova: começa no setor 0 (apagado na primeira gravação)
+        log->sector = log->sectors - 1;
+        log->page = log->pages_per_sector;
+        return 0;
+    }
+
+    // Os setores são ocupados em ordem circular: o mais antigo segue o mais recente
+    for (uint16_t i = 1; i <= log->sectors; ++i)
+    {
+        uint16_t s = (log->sector + i) % log->sectors;
+        uint32_t sector_seq;
+
+        if (!sector_header(log, s, &sector_seq) || sector_seq > log->sector_seq)
+            continue;
+        for (uint16_t p = 0; p < log->pages_per_sector; ++p)
+        {
+            dev->read(dev->ctx, page_offset(log, s, p), page, FLASH_LOG_PAGE_SIZE);
+            if (page_erased(page))
+            {
+                if (s == log->sector)
+                {
+                    log->page = p;
+                    return count;
+                }
+                break;
+            }
+            count += replay_page(log, page, p == 0 ? FLASH_LOG_SECTOR_HEADER_SIZE : 0, replay, ctx);
+        }
+    }
+
+    log->page = log->pages_per_sector; // Setor mais recente cheio
+    return count;
+}
+
+// Grava a página em buffer. Ao sair do último setor, apaga o próximo na
+// ordem circular (o mais antigo) e inicia nele uma nova sequência.
+static bool flash_log_write_page(flash_log_t *log)
+{
+    bool ok = log->dev->program(log->dev->ctx, page_offset(log, log->sector, log->page), log->page_buffer);
+
+    log->pages_written++;
+    log->page++;
+    log->fill = 0;
+    memset(log->page_buffer, 0xFF, FLASH_LOG_PAGE_SIZE);
+    return ok;
+}
+
+// Garante uma página em buffer pronta para receber registros.
+static bool flash_log_open_page(flash_log_t *log)
+{
+    if (log->fill > 0)
+        return true;
+
+    memset(log->page_buffer, 0xFF, FLASH_LOG_PAGE_SIZE);
+    if (log->page >= log->pages_per_sector)
+    {
+        log->sector = (log->sector + 1) % log->sectors;
+        log->page = 0;
+        log->sector_seq++;
+        log->sectors_erased++;
+        if (!log->dev->erase(log->dev->ctx, page_offset(log, log->sector, 0)))
+            return false;
+    }
+    if (log->page == 0)
+    {
+        put_u32(&log->page_buffer[0], SECTOR_MAGIC);
+        put_u32(&log->page_buffer[4], log->sector_seq);
+        log->fill = FLASH_LOG_SECTOR_HEADER_SIZE;
+    }
+    return true;
+}
+
+// Acrescenta um registro ao buffer da página; a página só vai para a flash
+// quando não couber o próximo registro ou em flash_log_flush.
+bool flash_log_append(flash_log_t *log, uint8_t type, const void *data, uint8_t len)
+{
+    if (len > FLASH_LOG_MAX_DATA)
+        return false;
+    if (log->fill + FLASH_LOG_RECORD_HEADER_SIZE + len > FLASH_LOG_PAGE_SIZE && !flash_log_write_page(log))
+        return false;
+    if (!flash_log_open_page(log))
+        return false;
+
+    uint8_t *record = &log->page_buffer[log->fill];
+    record[0] = len;
+    record[1] = type;
+    put_u32(&record[4], log->seq++);
+    memcpy(&record[FLASH_LOG_RECORD_HEADER_SIZE], data, len);
+    uint16_t crc = record_crc(record, len);
+    record[2] = (uint8_t)crc;
+    record[3] = (uint8_t)(crc >> 8);
+    log->fill += FLASH_LOG_RECORD_HEADER_SIZE + len;
+    return true;
+}
+
+// Grava a página parcial em buffer. O restante dela fica apagado e não é
+// reaproveitado: cada página é gravada uma única vez.
+bool flash_log_flush(flash_log_t *log)
+{
+    if (log->fill == 0)
+        return true;
+    return flash_log_write_page(log);
+}
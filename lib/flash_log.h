@@ -0,0 +1,53 @@
+#ifndef FLASH_LOG_H
+#define FLASH_LOG_H
+
+// Log de registros apenas de acréscimo em uma região de flash NOR, com
+// rodízio circular de setores (desgaste uniforme), gravação em páginas
+// inteiras e CRC + número de sequência em cada registro. Apenas C padrão:
+// a flash é acessada pela interface flash_log_dev_t, implementada para o
+// RP2040 (flash_log_pico.c) e por um simulador no host (tools/).
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#define FLASH_LOG_PAGE_SIZE 256
+#define FLASH_LOG_MAX_DATA (FLASH_LOG_PAGE_SIZE - FLASH_LOG_SECTOR_HEADER_SIZE - FLASH_LOG_RECORD_HEADER_SIZE)
+#define FLASH_LOG_SECTOR_HEADER_SIZE 8 // Marca + sequência do setor
+#define FLASH_LOG_RECORD_HEADER_SIZE 8 // Tamanho, tipo, CRC, sequência
+
+// Região de flash: leitura livre; gravação de páginas inteiras já apagadas;
+// apagamento de um setor por vez. Offsets relativos ao início da região.
+typedef struct
+{
+    uint32_t size;
+    uint32_t sector_size;
+    bool (*read)(void *ctx, uint32_t offset, void *dst, uint32_t len);
+    bool (*program)(void *ctx, uint32_t offset, const void *page);
+    bool (*erase)(void *ctx, uint32_t offset);
+    void *ctx;
+} flash_log_dev_t;
+
+typedef void (*flash_log_replay_t)(void *ctx, uint8_t type, const uint8_t *data, uint8_t len, uint32_t seq);
+
+typedef struct
+{
+    const flash_log_dev_t *dev;
+    uint16_t sectors;
+    uint16_t pages_per_sector;
+    uint16_t sector;     // Setor em gravação
+    uint16_t page;       // Próxima página livre no setor
+    uint32_t sector_seq; // Sequência do setor em gravação
+    uint32_t seq;        // Sequência do próximo registro
+    uint16_t fill;       // Bytes ocupados em page_buffer
+    uint8_t page_buffer[FLASH_LOG_PAGE_SIZE];
+    uint32_t pages_written;
+    uint32_t sectors_erased;
+    uint32_t records_lost; // Registros descartados na montagem (CRC inválido)
+} flash_log_t;
+
+uint32_t flash_log_mount(flash_log_t *log, const flash_log_dev_t *dev, flash_log_replay_t replay, void *ctx);
+bool flash_log_append(flash_log_t *log, uint8_t type, const void *data, uint8_t len);
+bool flash_log_flush(flash_log_t *log);
+
+#endif // FLASH_LOG_H
@@ -0,0 +1,51 @@
+#include <string.h>
+#include <assert.h>
+#include "flash_log_pico.h"
+#include "hardware/sync.h"
+#include "pico/multicore.h"
+
+// Leitura direta pelo mapeamento XIP.
+static bool pico_read(void *ctx, uint32_t offset, void *dst, uint32_t len)
+{
+    memcpy(dst, (const void *)(uintptr_t)(XIP_BASE + FLASH_LOG_REGION_OFFSET + offset), len);
+    return true;
+}
+
+// Gravar ou apagar desliga o XIP: o núcleo 1 é pausado (em RAM) e as
+// interrupções deste núcleo ficam desabilitadas durante a operação. Nada
+// disso para o DMA: nenhum canal pode ler a flash (dados const, XIP) enquanto
+// a operação dura, senão lê lixo ou para com erro de barramento. Todos os
+// canais do firmware leem e escrevem apenas RAM e periféricos.
+static bool pico_program(void *ctx, uint32_t offset, const void *page)
+{
+    multicore_lockout_start_blocking();
+    uint32_t irq = save_and_disable_interrupts();
+    flash_range_program(FLASH_LOG_REGION_OFFSET + offset, page, FLASH_PAGE_SIZE);
+    restore_interrupts(irq);
+    multicore_lockout_end_blocking();
+    return true;
+}
+
+static bool pico_erase(void *ctx, uint32_t offset)
+{
+    multicore_lockout_start_blocking();
+    uint32_t irq = save_and_disable_interrupts();
+    flash_range_erase(FLASH_LOG_REGION_OFFSET + offset, FLASH_SECTOR_SIZE);
+    restore_interrupts(irq);
+    multicore_lockout_end_blocking();
+    return true;
+}
+
+// Preenche a interface do log com a região reservada da flash interna.
+// O núcleo 1 deve chamar multicore_lockout_victim_init() antes da primeira gravação.
+void flash_log_pico_device(flash_log_dev_t *dev)
+{
+    static_assert(FLASH_PAGE_SIZE == FLASH_LOG_PAGE_SIZE, "Página do log difere da página da flash");
+
+    dev->size = FLASH_LOG_REGION_SIZE;
+    dev->sector_size = FLASH_SECTOR_SIZE;
+    dev->read = pico_read;
+    dev->program = pico_program;
+    dev->erase = pico_erase;
+    dev->ctx = NULL;
+}
@@ -0,0 +1,16 @@
+#ifndef FLASH_LOG_PICO_H
+#define FLASH_LOG_PICO_H
+
+#include "pico/stdlib.h"
+#include "hardware/flash.h"
+#include "flash_log.h"
+
+// Região reservada no fim da flash, fora do alcance do programa.
+#ifndef FLASH_LOG_REGION_SIZE
+#define FLASH_LOG_REGION_SIZE (64 * 1024)
+#endif
+#define FLASH_LOG_REGION_OFFSET (PICO_FLASH_SIZE_BYTES - FLASH_LOG_REGION_SIZE)
+
+void flash_log_pico_device(flash_log_dev_t *dev);
+
+#endif // FLASH_LOG_PICO_H
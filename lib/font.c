@@ -0,0 +1,69 @@
+#include "font.h"
+
+// Índices dos glifos, na ordem de font_glyphs.h (0: glifo em branco).
+enum
+{
+    FONT_GLYPH_BLANK,
+#define FONT_GLYPH(code, ...) FONT_GLYPH_##code,
+#include "font_glyphs.h"
+#undef FONT_GLYPH
+    FONT_GLYPH_COUNT
+};
+
+const uint8_t font_map[256] = {
+#define FONT_GLYPH(code, ...) [code] = FONT_GLYPH_##code,
+#include "font_glyphs.h"
+#undef FONT_GLYPH
+};
+
+static const uint8_t small_glyphs[FONT_GLYPH_COUNT * 8] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+#define FONT_GLYPH(code, c0, c1, c2, c3, c4, c5, c6, c7) c0, c1, c2, c3, c4, c5, c6, c7,
+#include "font_glyphs.h"
+#undef FONT_GLYPH
+};
+
+// Ampliação na compilação: cada bit da coluna vira FONT_LARGE_SCALE bits
+// (FONT_SPREAD) e cada coluna vira FONT_LARGE_SCALE colunas iguais, já
+// divididas em páginas. Desenhar um glifo grande é a mesma cópia de bytes
+// de um pequeno, sem ampliar pixel a pixel.
+#define FONT_BIT(b, i) ((uint32_t)(((b) >> (i)) & 1u) * ((1u << FONT_LARGE_SCALE) - 1) << (FONT_LARGE_SCALE * (i)))
+#define FONT_SPREAD(b)                                                                                    \
+    (FONT_BIT(b, 0) | FONT_BIT(b, 1) | FONT_BIT(b, 2) | FONT_BIT(b, 3) | FONT_BIT(b, 4) | FONT_BIT(b, 5) | \
+     FONT_BIT(b, 6) | FONT_BIT(b, 7))
+#define FONT_PAGE(b, p) (uint8_t)(FONT_SPREAD(b) >> (8 * (p)))
+
+#if FONT_LARGE_SCALE == 2
+#define FONT_LARGE_COLUMN(b) FONT_PAGE(b, 0), FONT_PAGE(b, 1),
+#define FONT_LARGE_COLUMNS(b) FONT_LARGE_COLUMN(b) FONT_LARGE_COLUMN(b)
+#elif FONT_LARGE_SCALE == 3
+#define FONT_LARGE_COLUMN(b) FONT_PAGE(b, 0), FONT_PAGE(b, 1), FONT_PAGE(b, 2),
+#define FONT_LARGE_COLUMNS(b) FONT_LARGE_COLUMN(b) FONT_LARGE_COLUMN(b) FONT_LARGE_COLUMN(b)
+#else
+#error "FONT_LARGE_SCALE deve ser 2 ou 3"
+#endif
+
+static const uint8_t large_glyphs[FONT_GLYPH_COUNT * 8 * FONT_LARGE_SCALE * FONT_LARGE_SCALE] = {
+    FONT_LARGE_COLUMNS(0) FONT_LARGE_COLUMNS(0) FONT_LARGE_COLUMNS(0) FONT_LARGE_COLUMNS(0)
+    FONT_LARGE_COLUMNS(0) FONT_LARGE_COLUMNS(0) FONT_LARGE_COLUMNS(0) FONT_LARGE_COLUMNS(0)
+#define FONT_GLYPH(code, c0, c1, c2, c3, c4, c5, c6, c7)                                                  \
+    FONT_LARGE_COLUMNS(c0) FONT_LARGE_COLUMNS(c1) FONT_LARGE_COLUMNS(c2) FONT_LARGE_COLUMNS(c3)            \
+    FONT_LARGE_COLUMNS(c4) FONT_LARGE_COLUMNS(c5) FONT_LARGE_COLUMNS(c6) FONT_LARGE_COLUMNS(c7)
+#include "font_glyphs.h"
+#undef FONT_GLYPH
+};
+
+const font_t font_small = {8, 1, small_glyphs};
+const font_t font_large = {8 * FONT_LARGE_SCALE, FONT_LARGE_SCALE, large_glyphs};
+
+// Largura em pixels do texto UTF-8 desenhado com a fonte.
+uint16_t font_text_width(const font_t *font, const char *text)
+{
+    uint16_t width = 0;
+    while (*text)
+    {
+        font_next_code(&text);
+        width += font->width;
+    }
+    return width;
+}
@@ -0,0 +1,85 @@
+// Conjunto de glifos 8x8 das fontes (lista X-macro, incluída por font.c).
+// FONT_GLYPH(código Latin-1, 8 colunas): cada byte é uma coluna, bit 0 no
+// topo. Para incluir um caractere, acrescente uma linha; os ausentes
+// são desenhados em branco.
+
+FONT_GLYPH(0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00) // espaço
+FONT_GLYPH(0x21, 0x00, 0x00, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x00) // !
+FONT_GLYPH(0x25, 0x00, 0x00, 0x23, 0x13, 0x08, 0x64, 0x62, 0x00) // %
+FONT_GLYPH(0x27, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00) // '
+FONT_GLYPH(0x28, 0x00, 0x00, 0x1c, 0x22, 0x41, 0x00, 0x00, 0x00) // (
+FONT_GLYPH(0x29, 0x00, 0x00, 0x41, 0x22, 0x1c, 0x00, 0x00, 0x00) // )
+FONT_GLYPH(0x2b, 0x00, 0x08, 0x08, 0x3e, 0x08, 0x08, 0x00, 0x00) // +
+FONT_GLYPH(0x2c, 0x00, 0x00, 0x80, 0x60, 0x00, 0x00, 0x00, 0x00) // ,
+FONT_GLYPH(0x2d, 0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00) // -
+FONT_GLYPH(0x2e, 0x00, 0x00, 0x60, 0x60, 0x00, 0x00, 0x00, 0x00) // .
+FONT_GLYPH(0x2f, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x00, 0x00) // /
+FONT_GLYPH(0x30, 0x3e, 0x41, 0x41, 0x49, 0x41, 0x41, 0x3e, 0x00) // 0
+FONT_GLYPH(0x31, 0x00, 0x00, 0x42, 0x7f, 0x40, 0x00, 0x00, 0x00) // 1
+FONT_GLYPH(0x32, 0x30, 0x49, 0x49, 0x49, 0x49, 0x46, 0x00, 0x00) // 2
+FONT_GLYPH(0x33, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x36, 0x00) // 3
+FONT_GLYPH(0x34, 0x3f, 0x20, 0x20, 0x78, 0x20, 0x20, 0x00, 0x00) // 4
+FONT_GLYPH(0x35, 0x4f, 0x49, 0x49, 0x49, 0x49, 0x30, 0x00, 0x00) // 5
+FONT_GLYPH(0x36, 0x3f, 0x48, 0x48, 0x48, 0x48, 0x48, 0x30, 0x00) // 6
+FONT_GLYPH(0x37, 0x01, 0x01, 0x01, 0x61, 0x31, 0x0d, 0x03, 0x00) // 7
+FONT_GLYPH(0x38, 0x36, 0x49, 0x49, 0x49, 0x49, 0x49, 0x36, 0x00) // 8
+FONT_GLYPH(0x39, 0x06, 0x09, 0x09, 0x09, 0x09, 0x09, 0x7f, 0x00) // 9
+FONT_GLYPH(0x3a, 0x00, 0x66, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00) // :
+FONT_GLYPH(0x3c, 0x00, 0x08, 0x14, 0x22, 0x41, 0x00, 0x00, 0x00) // <
+FONT_GLYPH(0x3d, 0x00, 0x14, 0x14, 0x14, 0x14, 0x14, 0x00, 0x00) // =
+FONT_GLYPH(0x3e, 0x00, 0x41, 0x22, 0x14, 0x08, 0x00, 0x00, 0x00) // >
+FONT_GLYPH(0x3f, 0x02, 0x01, 0x51, 0x09, 0x06, 0x00, 0x00, 0x00) // ?
+FONT_GLYPH(0x41, 0x78, 0x14, 0x12, 0x11, 0x12, 0x14, 0x78, 0x00) // A
+FONT_GLYPH(0x42, 0x7f, 0x49, 0x49, 0x49, 0x49, 0x49, 0x7f, 0x00) // B
+FONT_GLYPH(0x43, 0x7e, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x00) // C
+FONT_GLYPH(0x44, 0x7f, 0x41, 0x41, 0x41, 0x41, 0x41, 0x7e, 0x00) // D
+FONT_GLYPH(0x45, 0x7f, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x00) // E
+FONT_GLYPH(0x46, 0x7f, 0x09, 0x09, 0x09, 0x09, 0x01, 0x01, 0x00) // F
+FONT_GLYPH(0x47, 0x7f, 0x41, 0x41, 0x41, 0x51, 0x51, 0x73, 0x00) // G
+FONT_GLYPH(0x48, 0x7f, 0x08, 0x08, 0x08, 0x08, 0x08, 0x7f, 0x00) // H
+FONT_GLYPH(0x49, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x00) // I
+FONT_GLYPH(0x4a, 0x21, 0x41, 0x41, 0x3f, 0x01, 0x01, 0x01, 0x00) // J
+FONT_GLYPH(0x4b, 0x00, 0x7f, 0x08, 0x08, 0x14, 0x22, 0x41, 0x00) // K
+FONT_GLYPH(0x4c, 0x7f, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x00) // L
+FONT_GLYPH(0x4d, 0x7f, 0x02, 0x04, 0x08, 0x04, 0x02, 0x7f, 0x00) // M
+FONT_GLYPH(0x4e, 0x7f, 0x02, 0x04, 0x08, 0x10, 0x20, 0x7f, 0x00) // N
+FONT_GLYPH(0x4f, 0x3e, 0x41, 0x41, 0x41, 0x41, 0x41, 0x3e, 0x00) // O
+FONT_GLYPH(0x50, 0x7f, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0e, 0x00) // P
+FONT_GLYPH(0x51, 0x3e, 0x41, 0x41, 0x49, 0x51, 0x61, 0x7e, 0x00) // Q
+FONT_GLYPH(0x52, 0x7f, 0x11, 0x11, 0x11, 0x31, 0x51, 0x0e, 0x00) // R
+FONT_GLYPH(0x53, 0x46, 0x49, 0x49, 0x49, 0x49, 0x30, 0x00, 0x00) // S
+FONT_GLYPH(0x54, 0x01, 0x01, 0x01, 0x7f, 0x01, 0x01, 0x01, 0x00) // T
+FONT_GLYPH(0x55, 0x3f, 0x40, 0x40, 0x40, 0x40, 0x40, 0x3f, 0x00) // U
+FONT_GLYPH(0x56, 0x0f, 0x10, 0x20, 0x40, 0x20, 0x10, 0x0f, 0x00) // V
+FONT_GLYPH(0x57, 0x7f, 0x20, 0x10, 0x08, 0x10, 0x20, 0x7f, 0x00) // W
+FONT_GLYPH(0x58, 0x00, 0x41, 0x22, 0x14, 0x14, 0x22, 0x41, 0x00) // X
+FONT_GLYPH(0x59, 0x01, 0x02, 0x04, 0x78, 0x04, 0x02, 0x01, 0x00) // Y
+FONT_GLYPH(0x5a, 0x41, 0x61, 0x59, 0x45, 0x43, 0x41, 0x00, 0x00) // Z
+FONT_GLYPH(0x5f, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x00) // _
+FONT_GLYPH(0x61, 0x20, 0x54, 0x54, 0x54, 0x54, 0x38, 0x00, 0x00) // a
+FONT_GLYPH(0x62, 0x7F, 0x48, 0x44, 0x44, 0x44, 0x38, 0x00, 0x00) // b
+FONT_GLYPH(0x63, 0x38, 0x44, 0x44, 0x44, 0x44, 0x20, 0x00, 0x00) // c
+FONT_GLYPH(0x64, 0x38, 0x44, 0x44, 0x44, 0x48, 0x7F, 0x00, 0x00) // d
+FONT_GLYPH(0x65, 0x38, 0x54, 0x54, 0x54, 0x54, 0x18, 0x00, 0x00) // e
+FONT_GLYPH(0x66, 0x08, 0x7E, 0x09, 0x01, 0x02, 0x00, 0x00, 0x00) // f
+FONT_GLYPH(0x67, 0x18, 0xA4, 0xA4, 0xA4, 0xA4, 0x7C, 0x00, 0x00) // g
+FONT_GLYPH(0x68, 0x7F, 0x08, 0x04, 0x04, 0x04, 0x78, 0x00, 0x00) // h
+FONT_GLYPH(0x69, 0x00, 0x00, 0x44, 0x7D, 0x40, 0x00, 0x00, 0x00) // i
+FONT_GLYPH(0x6a, 0x40, 0x80, 0x84, 0x7D, 0x00, 0x00, 0x00, 0x00) // j
+FONT_GLYPH(0x6b, 0x7F, 0x10, 0x28, 0x44, 0x44, 0x00, 0x00, 0x00) // k
+FONT_GLYPH(0x6c, 0x00, 0x41, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x00) // l
+FONT_GLYPH(0x6d, 0x7C, 0x04, 0x18, 0x04, 0x04, 0x78, 0x00, 0x00) // m
+FONT_GLYPH(0x6e, 0x7C, 0x08, 0x04, 0x04, 0x04, 0x78, 0x00, 0x00) // n
+FONT_GLYPH(0x6f, 0x38, 0x44, 0x44, 0x44, 0x44, 0x38, 0x00, 0x00) // o
+FONT_GLYPH(0x70, 0xFC, 0x24, 0x24, 0x24, 0x24, 0x18, 0x00, 0x00) // p
+FONT_GLYPH(0x71, 0x18, 0x24, 0x24, 0x24, 0x28, 0xFC, 0x00, 0x00) // q
+FONT_GLYPH(0x72, 0x7C, 0x08, 0x04, 0x04, 0x04, 0x08, 0x00, 0x00) // r
+FONT_GLYPH(0x73, 0x48, 0x54, 0x54, 0x54, 0x54, 0x20, 0x00, 0x00) // s
+FONT_GLYPH(0x74, 0x04, 0x3F, 0x44, 0x40, 0x20, 0x00, 0x00, 0x00) // t
+FONT_GLYPH(0x75, 0x3C, 0x40, 0x40, 0x40, 0x20, 0x7C, 0x00, 0x00) // u
+FONT_GLYPH(0x76, 0x1C, 0x20, 0x40, 0x40, 0x20, 0x1C, 0x00, 0x00) // v
+FONT_GLYPH(0x77, 0x3C, 0x40, 0x30, 0x40, 0x40, 0x3C, 0x00, 0x00) // w
+FONT_GLYPH(0x78, 0x44, 0x28, 0x10, 0x10, 0x28, 0x44, 0x00, 0x00) // x
+FONT_GLYPH(0x79, 0x4C, 0x90, 0x90, 0x90, 0x90, 0x7C, 0x00, 0x00) // y
+FONT_GLYPH(0x7a, 0x44, 0x64, 0x54, 0x4C, 0x44, 0x00, 0x00, 0x00) // z
+FONT_GLYPH(0xb0, 0x06, 0x09, 0x09, 0x06, 0x00, 0x00, 0x00, 0x00) // °
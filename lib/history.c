@@ -0,0 +1,160 @@
+#include "history.h"
+
+static const uint16_t tier_len[HISTORY_TIER_COUNT] = {HISTORY_RAW_LEN, HISTORY_MINUTE_LEN, HISTORY_HOUR_LEN};
+
+// Amostras brutas que compõem um item de cada camada.
+static const uint32_t tier_samples[HISTORY_TIER_COUNT] = {
+    1, HISTORY_SAMPLES_PER_MINUTE, HISTORY_SAMPLES_PER_MINUTE * HISTORY_MINUTES_PER_HOUR};
+
+static inline void accum_reset(history_accum_t *accum)
+{
+    accum->sum = 0;
+    accum->min = INT16_MAX;
+    accum->max = INT16_MIN;
+}
+
+static inline void accum_add(history_accum_t *accum, int16_t min, int16_t max, int16_t avg)
+{
+    accum->sum += avg;
+    if (min < accum->min)
+        accum->min = min;
+    if (max > accum->max)
+        accum->max = max;
+}
+
+static inline history_bucket_t accum_close(history_accum_t *accum, uint32_t count)
+{
+    history_bucket_t bucket = {accum->min, accum->max, (int16_t)(accum->sum / (int32_t)count)};
+    accum_reset(accum);
+    return bucket;
+}
+
+// Associa as séries (rooms * metrics, fornecidas pelo chamador) ao histórico.
+void history_init(history_t *history, history_series_t *series, uint8_t rooms, uint8_t metrics)
+{
+    history->series = series;
+    history->rooms = rooms;
+    history->metrics = metrics;
+    history->samples = 0;
+
+    for (uint16_t i = 0; i < rooms * metrics; ++i)
+    {
+        accum_reset(&series[i].minute_accum);
+        accum_reset(&series[i].hour_accum);
+    }
+}
+
+// Registra uma amostra de todas as séries: values[métrica][ambiente].
+// Cada camada é atualizada de forma incremental; um agregado por minuto
+// fecha a cada HISTORY_SAMPLES_PER_MINUTE amostras e alimenta o da hora.
+void history_record(history_t *history, const centi_t *const values[])
+{
+    uint32_t sample = history->samples;
+    uint16_t raw_pos = sample % HISTORY_RAW_LEN;
+    bool minute_done = (sample + 1) % HISTORY_SAMPLES_PER_MINUTE == 0;
+    uint32_t minute = sample / HISTORY_SAMPLES_PER_MINUTE;
+    bool hour_done = minute_done && (minute + 1) % HISTORY_MINUTES_PER_HOUR == 0;
+    uint16_t minute_pos = minute % HISTORY_MINUTE_LEN;
+    uint16_t hour_pos = minute / HISTORY_MINUTES_PER_HOUR % HISTORY_HOUR_LEN;
+    history_series_t *series = history->series;
+
+    for (uint8_t m = 0; m < history->metrics; ++m)
+    {
+        const centi_t *metric = values[m];
+
+        for (uint8_t r = 0; r < history->rooms; ++r, ++series)
+        {
+            centi_t value = metric[r];
+            int16_t v = value > INT16_MAX ? INT16_MAX : value < INT16_MIN ? INT16_MIN : (int16_t)value;
+
+            series->raw[raw_pos] = v;
+            accum_add(&series->minute_accum, v, v, v);
+            if (minute_done)
+            {
+                history_bucket_t bucket = accum_close(&series->minute_accum, HISTORY_SAMPLES_PER_MINUTE);
+                series->minutes[minute_pos] = bucket;
+                accum_add(&series->hour_accum, bucket.min, bucket.max, bucket.avg);
+                if (hour_done)
+                    series->hours[hour_pos] = accum_close(&series->hour_accum, HISTORY_MINUTES_PER_HOUR);
+            }
+        }
+    }
+
+    history->samples = sample + 1;
+}
+
+// Itens completos disponíveis em uma camada.
+uint16_t history_available(const history_t *history, uint8_t tier)
+{
+    uint32_t completed = history->samples / tier_samples[tier];
+    return completed < tier_len[tier] ? completed : tier_len[tier];
+}
+
+// Intervalo coberto por um item de cada camada.
+uint32_t history_bucket_ms(uint8_t tier)
+{
+    return tier_samples[tier] * HISTORY_SAMPLE_PERIOD_MS;
+}
+
+// Intervalo coberto por uma camada inteira.
+uint32_t history_span_ms(uint8_t tier)
+{
+    return tier_len[tier] * history_bucket_ms(tier);
+}
+
+// Item de uma camada pela idade (0: o mais recente completo).
+static history_bucket_t history_item(const history_t *history, const history_series_t *series, uint8_t tier,
+                                     uint16_t age)
+{
+    uint32_t completed = history->samples / tier_samples[tier];
+    uint16_t pos = (completed - 1 - age) % tier_len[tier];
+
+    switch (tier)
+    {
+    case HISTORY_TIER_RAW:
+        return (history_bucket_t){series->raw[pos], series->raw[pos], series->raw[pos]};
+    case HISTORY_TIER_MINUTE:
+        return series->minutes[pos];
+    default:
+        return series->hours[pos];
+    }
+}
+
+// Consulta os últimos span_ms de uma série, agregados em até points itens
+// (do mais antigo ao mais recente). Usa a camada mais fina que cobre o
+// intervalo, então o custo é limitado pelo tamanho de uma camada e não pelo
+// número de amostras brutas do período. Retorna o número de itens escritos.
+uint16_t history_range(const history_t *history, uint8_t room, uint8_t metric, uint32_t span_ms,
+                       history_bucket_t *out, uint16_t points)
+{
+    const history_series_t *series = &history->series[metric * history->rooms + room];
+    uint8_t tier = HISTORY_TIER_RAW;
+
+    while (tier + 1 < HISTORY_TIER_COUNT && (uint64_t)tier_len[tier] * history_bucket_ms(tier) < span_ms)
+        tier++;
+
+    uint32_t items = (span_ms + history_bucket_ms(tier) - 1) / history_bucket_ms(tier);
+    uint16_t available = history_available(history, tier);
+    if (items > available)
+        items = available;
+    if (points > items)
+        points = items;
+
+    // Cada ponto agrega um trecho contíguo de itens: [p * items / points, (p + 1) * items / points)
+    uint16_t item = 0;
+    for (uint16_t p = 0; p < points; ++p)
+    {
+        uint16_t end = (uint32_t)(p + 1) * items / points;
+        history_accum_t accum;
+        uint16_t count = end - item;
+
+        accum_reset(&accum);
+        for (; item < end; ++item)
+        {
+            history_bucket_t bucket = history_item(history, series, tier, items - 1 - item);
+            accum_add(&accum, bucket.min, bucket.max, bucket.avg);
+        }
+        out[p] = accum_close(&accum, count);
+    }
+    return points;
+}
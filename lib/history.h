@@ -0,0 +1,78 @@
+#ifndef HISTORY_H
+#define HISTORY_H
+
+#include "pico/stdlib.h"
+#include "fixed_point.h"
+
+// Camadas do histórico, todas configuráveis em tempo de compilação:
+// amostras brutas, agregados por minuto e agregados por hora.
+#ifndef HISTORY_SAMPLE_PERIOD_MS
+#define HISTORY_SAMPLE_PERIOD_MS 1000 // Intervalo entre amostras brutas
+#endif
+#ifndef HISTORY_RAW_LEN
+#define HISTORY_RAW_LEN 120 // 2 min de amostras brutas
+#endif
+#ifndef HISTORY_MINUTE_LEN
+#define HISTORY_MINUTE_LEN 120 // 2 h de agregados por minuto
+#endif
+#ifndef HISTORY_HOUR_LEN
+#define HISTORY_HOUR_LEN 48 // 2 dias de agregados por hora
+#endif
+#define HISTORY_SAMPLES_PER_MINUTE (60000 / HISTORY_SAMPLE_PERIOD_MS)
+#define HISTORY_MINUTES_PER_HOUR 60
+
+typedef enum
+{
+    HISTORY_TIER_RAW,
+    HISTORY_TIER_MINUTE,
+    HISTORY_TIER_HOUR,
+    HISTORY_TIER_COUNT
+} history_tier_t;
+
+// Agregado de um intervalo, em centésimos (int16_t: até ±327,67).
+typedef struct
+{
+    int16_t min, max, avg;
+} history_bucket_t;
+
+// Agregado em formação: atualizado a cada amostra, sem reler a camada anterior.
+typedef struct
+{
+    int32_t sum;
+    int16_t min, max;
+} history_accum_t;
+
+// Histórico de uma métrica de um ambiente: um anel por camada.
+typedef struct
+{
+    int16_t raw[HISTORY_RAW_LEN];
+    history_bucket_t minutes[HISTORY_MINUTE_LEN];
+    history_bucket_t hours[HISTORY_HOUR_LEN];
+    history_accum_t minute_accum, hour_accum;
+} history_series_t;
+
+// Todas as séries avançam juntas, então as posições dos anéis são
+// derivadas de um único contador de amostras.
+typedef struct
+{
+    history_series_t *series; // rooms * metrics séries, agrupadas por métrica
+    uint8_t rooms;
+    uint8_t metrics;
+    uint32_t samples;
+} history_t;
+
+void history_init(history_t *history, history_series_t *series, uint8_t rooms, uint8_t metrics);
+void history_record(history_t *history, const centi_t *const values[]);
+uint16_t history_available(const history_t *history, uint8_t tier);
+uint32_t history_bucket_ms(uint8_t tier);
+uint32_t history_span_ms(uint8_t tier);
+uint16_t history_range(const history_t *history, uint8_t room, uint8_t metric, uint32_t span_ms,
+                       history_bucket_t *out, uint16_t points);
+
+// Memória ocupada pelo histórico (séries + controle).
+static inline uint32_t history_bytes(const history_t *history)
+{
+    return (uint32_t)history->rooms * history->metrics * sizeof(history_series_t) + sizeof(history_t);
+}
+
+#endif // HISTORY_H
@@ -0,0 +1,122 @@
+#include <string.h>
+#include "led_matrix_anim.h"
+#include "ws2812b.h"
+#include "font.h"
+
+// Converte o texto na faixa de colunas: cada glifo contribui apenas com as
+// colunas acesas, mais uma de espaçamento; caracteres sem glifo (espaço)
+// viram duas colunas em branco. O texto que não couber é cortado.
+static void led_anim_load(led_anim_t *anim, const char *text, const uint8_t color[3])
+{
+    strcpy(anim->text, text);
+    memcpy(anim->color, color, 3);
+    for (uint8_t level = 0; level <= LED_ANIM_FADE_STEPS; ++level)
+        for (uint8_t k = 0; k < 3; ++k)
+            anim->ramp[level][k] = color[k] * level / LED_ANIM_FADE_STEPS;
+
+    uint8_t count = 0;
+    while (*text)
+    {
+        led_matrix_glyph_t glyph = led_matrix_glyph(font_next_code(&text));
+        uint8_t first = 0, last = 1; // Espaço: duas colunas em branco (mais o espaçamento abaixo)
+        if (glyph != 0)
+        {
+            for (first = 0; led_matrix_glyph_column(glyph, first) == 0; ++first)
+                ;
+            for (last = LED_MATRIX_SIZE - 1; led_matrix_glyph_column(glyph, last) == 0; --last)
+                ;
+        }
+        if (count + (last - first + 2) + LED_MATRIX_SIZE > LED_ANIM_MAX_COLUMNS)
+            break;
+        for (uint8_t c = first; c <= last; ++c)
+            anim->columns[count++] = led_matrix_glyph_column(glyph, c);
+        anim->columns[count++] = 0;
+    }
+    memset(&anim->columns[count], 0, LED_MATRIX_SIZE);
+    anim->count = count + LED_MATRIX_SIZE;
+
+    // Começa com a janela no intervalo: o texto entra pela direita
+    anim->offset = count;
+}
+
+// Janela de 5 colunas a partir de offset, com a faixa em laço
+static led_matrix_glyph_t led_anim_window(const led_anim_t *anim)
+{
+    led_matrix_glyph_t window = 0;
+    uint8_t column = anim->offset;
+    for (uint8_t c = 0; c < LED_MATRIX_SIZE; ++c)
+    {
+        window |= (led_matrix_glyph_t)anim->columns[column] << (LED_MATRIX_SIZE * c);
+        if (++column == anim->count)
+            column = 0;
+    }
+    return window;
+}
+
+void led_anim_init(led_anim_t *anim)
+{
+    static const uint8_t off[3] = {0, 0, 0};
+    led_anim_load(anim, "", off);
+    anim->from = anim->to = 0;
+    anim->step = LED_ANIM_FADE_STEPS;
+    anim->pending = false;
+}
+
+// Agenda um novo texto e cor. A troca acontece quando a janela passa pelo
+// intervalo em branco, para não interromper uma rolagem em andamento; chamar
+// com o mesmo texto e cor não tem custo.
+void led_anim_set_text(led_anim_t *anim, const char *text, uint8_t r, uint8_t g, uint8_t b)
+{
+    const uint8_t color[3] = {r, g, b};
+    const char *current = anim->pending ? anim->pending_text : anim->text;
+    const uint8_t *current_color = anim->pending ? anim->pending_color : anim->color;
+
+    if (strncmp(text, current, LED_ANIM_TEXT_MAX) == 0 && memcmp(color, current_color, 3) == 0)
+        return;
+
+    strncpy(anim->pending_text, text, LED_ANIM_TEXT_MAX);
+    anim->pending_text[LED_ANIM_TEXT_MAX] = '\0';
+    memcpy(anim->pending_color, color, 3);
+    anim->pending = true;
+
+    // Sem texto em exibição: nada a esperar
+    if (anim->count == LED_MATRIX_SIZE)
+    {
+        anim->pending = false;
+        led_anim_load(anim, anim->pending_text, anim->pending_color);
+    }
+}
+
+// Avança um frame (chamar a período fixo) e monta o buffer da matriz:
+// o nível de cada pixel sai das duas máscaras e a cor, da rampa pré-calculada.
+// O chamador envia o frame com ws2812b_write.
+void led_anim_frame(led_anim_t *anim)
+{
+    if (anim->step < LED_ANIM_FADE_STEPS)
+    {
+        anim->step++;
+    }
+    else
+    {
+        if (++anim->offset == anim->count)
+            anim->offset = 0;
+        // Janela toda no intervalo em branco: troca o texto sem corte visível
+        if (anim->pending && anim->offset == anim->count - LED_MATRIX_SIZE)
+        {
+            anim->pending = false;
+            led_anim_load(anim, anim->pending_text, anim->pending_color);
+        }
+        anim->from = anim->to;
+        anim->to = led_anim_window(anim);
+        anim->step = 1;
+    }
+
+    led_matrix_glyph_t from = anim->from, to = anim->to;
+    uint8_t fade_in = anim->step, fade_out = LED_ANIM_FADE_STEPS - anim->step;
+    for (uint8_t i = 0; i < LED_MATRIX_COUNT; ++i, from >>= 1, to >>= 1)
+    {
+        uint8_t level = ((from & 1) ? fade_out : 0) + ((to & 1) ? fade_in : 0);
+        const uint8_t *color = anim->ramp[level];
+        ws2812b_set_led(led_matrix_index[i], color[0], color[1], color[2]);
+    }
+}
@@ -0,0 +1,36 @@
+#ifndef LED_MATRIX_ANIM_H
+#define LED_MATRIX_ANIM_H
+
+#include "pico/stdlib.h"
+#include "led_matrix_glyphs.h"
+
+#define LED_ANIM_TEXT_MAX 12    // Bytes do texto rolado (UTF-8)
+#define LED_ANIM_MAX_COLUMNS 80 // Colunas da faixa: texto + intervalo em branco
+#define LED_ANIM_FADE_STEPS 4   // Frames de transição entre duas posições da rolagem
+
+// Texto rolando da direita para a esquerda, em laço. O texto é convertido
+// uma única vez numa faixa de colunas de 5 bits, seguida de um intervalo em
+// branco do tamanho da matriz; cada posição da rolagem é uma janela de 5
+// colunas (uma máscara de 25 bits), e a passagem de uma janela à seguinte
+// dura LED_ANIM_FADE_STEPS frames de transição cruzada.
+typedef struct
+{
+    uint8_t columns[LED_ANIM_MAX_COLUMNS];
+    uint8_t count;
+    uint8_t offset;                // Primeira coluna da janela atual
+    uint8_t step;                  // Frames já passados na transição para a janela atual
+    led_matrix_glyph_t from, to;   // Janela anterior e atual
+    uint8_t ramp[LED_ANIM_FADE_STEPS + 1][3]; // Cor em cada nível da transição (0: apagado)
+    char text[LED_ANIM_TEXT_MAX + 1];
+    uint8_t color[3];
+    // Próximo texto, trocado quando a janela passa pelo intervalo em branco
+    char pending_text[LED_ANIM_TEXT_MAX + 1];
+    uint8_t pending_color[3];
+    bool pending;
+} led_anim_t;
+
+void led_anim_init(led_anim_t *anim);
+void led_anim_set_text(led_anim_t *anim, const char *text, uint8_t r, uint8_t g, uint8_t b);
+void led_anim_frame(led_anim_t *anim);
+
+#endif // LED_MATRIX_ANIM_H
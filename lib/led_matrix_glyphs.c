@@ -0,0 +1,91 @@
+#include "led_matrix_glyphs.h"
+
+// Glifo a partir das 5 linhas escritas como no desenho (bit 4 à esquerda),
+// convertido para colunas em tempo de compilação.
+#define GLYPH_PIXEL(row, r, c) ((uint32_t)(((row) >> (4 - (c))) & 1) << (LED_MATRIX_SIZE * (c) + (r)))
+#define GLYPH_ROW(row, r) \
+    (GLYPH_PIXEL(row, r, 0) | GLYPH_PIXEL(row, r, 1) | GLYPH_PIXEL(row, r, 2) | GLYPH_PIXEL(row, r, 3) | GLYPH_PIXEL(row, r, 4))
+#define GLYPH(r0, r1, r2, r3, r4) \
+    (GLYPH_ROW(r0, 0) | GLYPH_ROW(r1, 1) | GLYPH_ROW(r2, 2) | GLYPH_ROW(r3, 3) | GLYPH_ROW(r4, 4))
+
+// ASCII de ' ' a 'Z', em flash; letras minúsculas usam as maiúsculas e
+// caracteres sem glifo ficam em branco.
+#define GLYPH_FIRST ' '
+#define GLYPH_LAST 'Z'
+static const led_matrix_glyph_t glyphs[GLYPH_LAST - GLYPH_FIRST + 1] = {
+    ['!' - GLYPH_FIRST] = GLYPH(0b00100, 0b00100, 0b00100, 0b00000, 0b00100),
+    ['%' - GLYPH_FIRST] = GLYPH(0b11001, 0b11010, 0b00100, 0b01011, 0b10011),
+    ['+' - GLYPH_FIRST] = GLYPH(0b00000, 0b00100, 0b01110, 0b00100, 0b00000),
+    ['-' - GLYPH_FIRST] = GLYPH(0b00000, 0b00000, 0b01110, 0b00000, 0b00000),
+    ['.' - GLYPH_FIRST] = GLYPH(0b00000, 0b00000, 0b00000, 0b00000, 0b00100),
+    ['0' - GLYPH_FIRST] = GLYPH(0b01110, 0b01010, 0b01010, 0b01010, 0b01110),
+    ['1' - GLYPH_FIRST] = GLYPH(0b00100, 0b01100, 0b00100, 0b00100, 0b00100),
+    ['2' - GLYPH_FIRST] = GLYPH(0b01110, 0b00010, 0b01110, 0b01000, 0b01110),
+    ['3' - GLYPH_FIRST] = GLYPH(0b01110, 0b00010, 0b01110, 0b00010, 0b01110),
+    ['4' - GLYPH_FIRST] = GLYPH(0b01010, 0b01010, 0b01110, 0b00010, 0b00010),
+    ['5' - GLYPH_FIRST] = GLYPH(0b01110, 0b01000, 0b01110, 0b00010, 0b01110),
+    ['6' - GLYPH_FIRST] = GLYPH(0b01110, 0b01000, 0b01110, 0b01010, 0b01110),
+    ['7' - GLYPH_FIRST] = GLYPH(0b01110, 0b00010, 0b00010, 0b00010, 0b00010),
+    ['8' - GLYPH_FIRST] = GLYPH(0b01110, 0b01010, 0b01110, 0b01010, 0b01110),
+    ['9' - GLYPH_FIRST] = GLYPH(0b01110, 0b01010, 0b01110, 0b00010, 0b00010),
+    [':' - GLYPH_FIRST] = GLYPH(0b00000, 0b00100, 0b00000, 0b00100, 0b00000),
+    ['?' - GLYPH_FIRST] = GLYPH(0b01110, 0b10001, 0b00110, 0b00000, 0b00100),
+    ['A' - GLYPH_FIRST] = GLYPH(0b01110, 0b10001, 0b11111, 0b10001, 0b10001),
+    ['B' - GLYPH_FIRST] = GLYPH(0b11110, 0b10001, 0b11110, 0b10001, 0b11110),
+    ['C' - GLYPH_FIRST] = GLYPH(0b01111, 0b10000, 0b10000, 0b10000, 0b01111),
+    ['D' - GLYPH_FIRST] = GLYPH(0b11110, 0b10001, 0b10001, 0b10001, 0b11110),
+    ['E' - GLYPH_FIRST] = GLYPH(0b11111, 0b10000, 0b11110, 0b10000, 0b11111),
+    ['F' - GLYPH_FIRST] = GLYPH(0b11111, 0b10000, 0b11110, 0b10000, 0b10000),
+    ['G' - GLYPH_FIRST] = GLYPH(0b01111, 0b10000, 0b10011, 0b10001, 0b01111),
+    ['H' - GLYPH_FIRST] = GLYPH(0b10001, 0b10001, 0b11111, 0b10001, 0b10001),
+    ['I' - GLYPH_FIRST] = GLYPH(0b01110, 0b00100, 0b00100, 0b00100, 0b01110),
+    ['J' - GLYPH_FIRST] = GLYPH(0b00111, 0b00010, 0b00010, 0b10010, 0b01100),
+    ['K' - GLYPH_FIRST] = GLYPH(0b10010, 0b10100, 0b11000, 0b10100, 0b10010),
+    ['L' - GLYPH_FIRST] = GLYPH(0b10000, 0b10000, 0b10000, 0b10000, 0b11111),
+    ['M' - GLYPH_FIRST] = GLYPH(0b10001, 0b11011, 0b10101, 0b10001, 0b10001),
+    ['N' - GLYPH_FIRST] = GLYPH(0b10001, 0b11001, 0b10101, 0b10011, 0b10001),
+    ['O' - GLYPH_FIRST] = GLYPH(0b01110, 0b10001, 0b10001, 0b10001, 0b01110),
+    ['P' - GLYPH_FIRST] = GLYPH(0b11110, 0b10001, 0b11110, 0b10000, 0b10000),
+    ['Q' - GLYPH_FIRST] = GLYPH(0b01110, 0b10001, 0b10101, 0b10010, 0b01101),
+    ['R' - GLYPH_FIRST] = GLYPH(0b11110, 0b10001, 0b11110, 0b10010, 0b10001),
+    ['S' - GLYPH_FIRST] = GLYPH(0b01111, 0b10000, 0b01110, 0b00001, 0b11110),
+    ['T' - GLYPH_FIRST] = GLYPH(0b11111, 0b00100, 0b00100, 0b00100, 0b00100),
+    ['U' - GLYPH_FIRST] = GLYPH(0b10001, 0b10001, 0b10001, 0b10001, 0b01110),
+    ['V' - GLYPH_FIRST] = GLYPH(0b10001, 0b10001, 0b10001, 0b01010, 0b00100),
+    ['W' - GLYPH_FIRST] = GLYPH(0b10001, 0b10001, 0b10101, 0b11011, 0b10001),
+    ['X' - GLYPH_FIRST] = GLYPH(0b10001, 0b01010, 0b00100, 0b01010, 0b10001),
+    ['Y' - GLYPH_FIRST] = GLYPH(0b10001, 0b01010, 0b00100, 0b00100, 0b00100),
+    ['Z' - GLYPH_FIRST] = GLYPH(0b11111, 0b00010, 0b00100, 0b01000, 0b11111),
+};
+static const led_matrix_glyph_t glyph_degree = GLYPH(0b01000, 0b10100, 0b01000, 0b00000, 0b00000); // '°' (Latin-1 0xB0)
+
+// Pixel lógico -> LED: a fiação começa no canto inferior direito e alterna o
+// sentido a cada linha (linhas pares da base da direita para a esquerda).
+#define LED_INDEX(c, r) ((4 - (r)) * LED_MATRIX_SIZE + (((4 - (r)) & 1) ? (c) : 4 - (c)))
+#define LED_INDEX_COLUMN(c) LED_INDEX(c, 0), LED_INDEX(c, 1), LED_INDEX(c, 2), LED_INDEX(c, 3), LED_INDEX(c, 4)
+const uint8_t led_matrix_index[LED_MATRIX_COUNT] = {
+    LED_INDEX_COLUMN(0), LED_INDEX_COLUMN(1), LED_INDEX_COLUMN(2), LED_INDEX_COLUMN(3), LED_INDEX_COLUMN(4),
+};
+
+const uint8_t led_matrix_number_colors[10][3] = {
+    {255, 0, 0},     // Vermelho
+    {0, 255, 0},     // Verde
+    {0, 0, 255},     // Azul
+    {255, 255, 0},   // Amarelo
+    {0, 255, 255},   // Ciano
+    {255, 0, 255},   // Magenta
+    {255, 255, 255}, // Branco
+    {255, 200, 0},   // Laranja
+    {180, 0, 180},   // Roxo
+    {200, 110, 110}  // Marrom
+};
+
+// Glifo de um caractere Latin-1 (0 se não houver).
+led_matrix_glyph_t led_matrix_glyph(uint8_t code)
+{
+    if (code >= 'a' && code <= 'z')
+        code -= 'a' - 'A';
+    if (code >= GLYPH_FIRST && code <= GLYPH_LAST)
+        return glyphs[code - GLYPH_FIRST];
+    return code == 0xB0 ? glyph_degree : 0;
+}
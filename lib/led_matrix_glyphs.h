@@ -0,0 +1,31 @@
+#ifndef LED_MATRIX_GLYPHS_H
+#define LED_MATRIX_GLYPHS_H
+
+#include "pico/stdlib.h"
+
+#define LED_MATRIX_SIZE 5
+#define LED_MATRIX_COUNT (LED_MATRIX_SIZE * LED_MATRIX_SIZE)
+
+// Glifo 5x5 empacotado em 25 bits, por colunas: o bit (5 * coluna + linha)
+// acende o pixel, com a linha 0 no topo e a coluna 0 à esquerda. Cada coluna
+// ocupa 5 bits consecutivos, então rolar o texto é deslocar a máscara.
+typedef uint32_t led_matrix_glyph_t;
+
+#define LED_MATRIX_COLUMN_MASK ((1u << LED_MATRIX_SIZE) - 1)
+
+// Coluna c (5 bits, linha 0 no bit 0) de um glifo
+static inline uint8_t led_matrix_glyph_column(led_matrix_glyph_t glyph, uint8_t c)
+{
+    return (glyph >> (LED_MATRIX_SIZE * c)) & LED_MATRIX_COLUMN_MASK;
+}
+
+// Pixel lógico (5 * coluna + linha) -> índice do LED na fiação em serpentina
+extern const uint8_t led_matrix_index[LED_MATRIX_COUNT];
+
+// Cores dos números (valores perceptuais; a gama e o brilho global são
+// aplicados por ws2812b_set_led)
+extern const uint8_t led_matrix_number_colors[10][3];
+
+led_matrix_glyph_t led_matrix_glyph(uint8_t code);
+
+#endif // LED_MATRIX_GLYPHS_H
@@ -1,29 +0,0 @@
-#include "led_matrix_numbers.h"
-
-// Definição dos números de 0 a 9 na matriz de LEDs
-int led_matrix_numbers[10][LED_MATRIX_COUNT] = {
-    {0, 1, 1, 1, 0, 0, 1, 0, 1, 0, 0, 1, 0, 1, 0, 0, 1, 0, 1, 0, 0, 1, 1, 1, 0},
-    {0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 1, 1, 0, 0, 0, 0, 1, 0, 0},
-    {0, 1, 1, 1, 0, 0, 1, 0, 0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 1, 0, 0, 1, 1, 1, 0},
-    {0, 1, 1, 1, 0, 0, 0, 0, 1, 0, 0, 1, 1, 1, 0, 0, 0, 0, 1, 0, 0, 1, 1, 1, 0},
-    {0, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 1, 1, 0, 0, 1, 0, 1, 0, 0, 1, 0, 1, 0},
-    {0, 1, 1, 1, 0, 0, 0, 0, 1, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 0, 0, 1, 1, 1, 0},
-    {0, 1, 1, 1, 0, 0, 1, 0, 1, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 0, 0, 1, 1, 1, 0},
-    {0, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 1, 1, 0},
-    {0, 1, 1, 1, 0, 0, 1, 0, 1, 0, 0, 1, 1, 1, 0, 0, 1, 0, 1, 0, 0, 1, 1, 1, 0},
-    {0, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 1, 1, 0, 0, 1, 0, 1, 0, 0, 1, 1, 1, 0},
-};
-
-// Definição das cores para os números
-int led_matrix_number_colors[10][3] = {
-    {15, 0, 0},   // Vermelho mais fraco
-    {0, 15, 0},   // Verde mais fraco
-    {0, 0, 15},   // Azul mais fraco
-    {15, 15, 0},  // Amarelo mais fraco
-    {0, 15, 15},  // Ciano mais fraco
-    {15, 0, 15},  // Magenta mais fraco
-    {15, 15, 15}, // Branco acinzentado
-    {15, 9, 0},   // Laranja mais fraco
-    {7, 0, 7},    // Roxo mais fraco
-    {9, 2, 2}     // Marrom mais fraco
-};
@@ -1,10 +0,0 @@
-#ifndef LED_MATRIX_NUMBERS_H
-#define LED_MATRIX_NUMBERS_H
-
-#define LED_MATRIX_COUNT 25
-
-// Declaração dos arrays (sem definição!)
-extern int led_matrix_numbers[10][LED_MATRIX_COUNT];
-extern int led_matrix_number_colors[10][3];
-
-#endif // LED_MATRIX_H
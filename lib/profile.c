@@ -0,0 +1,100 @@
+#include <stdio.h>
+#include "profile.h"
+
+static profile_stage_t *stages;
+static uint8_t stage_count;
+
+#if PROFILE_ENABLED
+
+static void profile_clear(profile_stage_t *stage)
+{
+    stage->count = 0;
+    stage->min_us = UINT32_MAX;
+    stage->max_us = 0;
+    stage->total_us = 0;
+    for (uint8_t b = 0; b < PROFILE_BUCKETS; ++b)
+        stage->buckets[b] = 0;
+    stage->reset = false;
+}
+
+// Balde do histograma: número de bits significativos da duração.
+static inline uint8_t profile_bucket(uint32_t elapsed_us)
+{
+    uint8_t bucket = elapsed_us ? 32 - __builtin_clz(elapsed_us) : 0;
+    return bucket < PROFILE_BUCKETS ? bucket : PROFILE_BUCKETS - 1;
+}
+
+#endif
+
+// Associa a tabela de estágios (fornecida pelo chamador) e zera as estatísticas.
+void profile_init(profile_stage_t *table, uint8_t count)
+{
+    stages = table;
+    stage_count = count;
+#if PROFILE_ENABLED
+    for (uint8_t i = 0; i < count; ++i)
+        profile_clear(&stages[i]);
+#endif
+}
+
+// Acumula uma medida do estágio. Chamar sempre do mesmo núcleo para cada estágio.
+void profile_record(profile_stage_t *stage, uint32_t elapsed_us)
+{
+#if PROFILE_ENABLED
+    if (stage->reset)
+        profile_clear(stage);
+
+    stage->count++;
+    stage->total_us += elapsed_us;
+    if (elapsed_us < stage->min_us)
+        stage->min_us = elapsed_us;
+    if (elapsed_us > stage->max_us)
+        stage->max_us = elapsed_us;
+    stage->buckets[profile_bucket(elapsed_us)]++;
+#endif
+}
+
+// Pede que todos os estágios sejam zerados; cada um é zerado na próxima
+// medida, pelo núcleo que o mede.
+void profile_reset()
+{
+#if PROFILE_ENABLED
+    for (uint8_t i = 0; i < stage_count; ++i)
+        stages[i].reset = true;
+#endif
+}
+
+// Imprime, por estágio, contagem, mínimo, média e máximo (us) e os baldes
+// não vazios do histograma como "<limite:contagem".
+void profile_dump()
+{
+#if PROFILE_ENABLED
+    printf("Perfil (us): estagio n min media max\n");
+    for (uint8_t i = 0; i < stage_count; ++i)
+    {
+        const profile_stage_t *stage = &stages[i];
+        uint32_t count = stage->count;
+
+        if (count == 0 || stage->reset)
+        {
+            printf("%-12s 0\n", stage->name);
+            continue;
+        }
+
+        printf("%-12s %lu %lu %lu %lu\n ", stage->name, (unsigned long)count, (unsigned long)stage->min_us,
+               (unsigned long)(stage->total_us / count), (unsigned long)stage->max_us);
+        for (uint8_t b = 0; b < PROFILE_BUCKETS; ++b)
+        {
+            if (stage->buckets[b] == 0)
+                continue;
+            if (b == PROFILE_BUCKETS - 1)
+                printf(" >=%lu:%lu", 1ul << (b - 1), (unsigned long)stage->buckets[b]);
+            else
+                printf(" <%lu:%lu", 1ul << b, (unsigned long)stage->buckets[b]);
+        }
+        printf("\n");
+    }
+#else
+    printf("Perfil desabilitado (PROFILE_ENABLED=0)\n");
+#endif
+}
@@ -0,0 +1,47 @@
+#ifndef PROFILE_H
+#define PROFILE_H
+
+#include "pico/stdlib.h"
+
+// 1: mede os estágios marcados com PROFILE_BEGIN/PROFILE_END; 0: remove a
+// instrumentação (macros vazias, sem estatísticas na RAM).
+#ifndef PROFILE_ENABLED
+#define PROFILE_ENABLED 1
+#endif
+
+// Histograma logarítmico: o balde b conta durações em [2^(b-1), 2^b) us
+// (balde 0: abaixo de 1 us); o último acumula tudo a partir de 2^14 us.
+#define PROFILE_BUCKETS 16
+
+// Estatísticas de um estágio, em memória fixa. Cada estágio deve ser medido
+// por um único núcleo; a leitura pelo outro núcleo pode ver uma amostra pela
+// metade, o que é aceitável para diagnóstico.
+typedef struct
+{
+    const char *name;
+#if PROFILE_ENABLED
+    uint32_t count;
+    uint32_t min_us;
+    uint32_t max_us;
+    uint64_t total_us;
+    uint32_t buckets[PROFILE_BUCKETS];
+    volatile bool reset; // Pedido de zerar, atendido pelo núcleo que mede
+#endif
+} profile_stage_t;
+
+#define PROFILE_STAGE(stage_name) { .name = (stage_name) }
+
+#if PROFILE_ENABLED
+#define PROFILE_BEGIN(start) uint32_t start = time_us_32()
+#define PROFILE_END(stage, start) profile_record((stage), time_us_32() - (start))
+#else
+#define PROFILE_BEGIN(start) ((void)0)
+#define PROFILE_END(stage, start) ((void)0)
+#endif
+
+void profile_init(profile_stage_t *stages, uint8_t count);
+void profile_record(profile_stage_t *stage, uint32_t elapsed_us);
+void profile_reset();
+void profile_dump();
+
+#endif // PROFILE_H
@@ -0,0 +1,77 @@
+#include <string.h>
+#include "room_store.h"
+
+// Esvazia o armazenamento.
+void room_store_init(room_store_t *store)
+{
+    memset(store, 0, sizeof(*store));
+}
+
+// Busca um nome já internado; retorna o offset ou -1.
+static int room_store_find_name(const room_store_t *store, const char *name)
+{
+    uint16_t offset = 0;
+
+    while (offset < store->names_used)
+    {
+        if (strcmp(&store->names[offset], name) == 0)
+            return offset;
+        offset += strlen(&store->names[offset]) + 1;
+    }
+    return -1;
+}
+
+// Adiciona um ambiente; nomes iguais compartilham a mesma entrada da tabela.
+// Retorna o índice do ambiente ou -1 se não houver espaço.
+int room_store_add(room_store_t *store, const char *name)
+{
+    size_t len = strnlen(name, ROOM_NAME_MAX - 1);
+    int offset = room_store_find_name(store, name);
+
+    if (store->count >= ROOM_STORE_CAPACITY)
+        return -1;
+
+    if (offset < 0)
+    {
+        if (store->names_used + len + 1 > ROOM_NAME_POOL_SIZE)
+            return -1;
+        offset = store->names_used;
+        memcpy(&store->names[offset], name, len);
+        store->names[offset + len] = '\0';
+        store->names_used += len + 1;
+    }
+
+    uint8_t room = store->count++;
+    store->name_offset[room] = offset;
+    store->temperature[room] = 0;
+    store->humidity[room] = 0;
+    room_store_set_cam(store, room, false);
+    return room;
+}
+
+// Mínimo, máximo e média de uma métrica, em uma varredura sequencial do vetor.
+void room_store_stats(const centi_t *values, uint8_t count, room_stats_t *stats)
+{
+    int32_t sum = 0;
+
+    stats->min = INT32_MAX;
+    stats->max = INT32_MIN;
+    stats->min_room = 0;
+    stats->max_room = 0;
+    for (uint8_t i = 0; i < count; ++i)
+    {
+        centi_t value = values[i];
+        sum += value;
+        if (value < stats->min)
+        {
+            stats->min = value;
+            stats->min_room = i;
+        }
+        if (value > stats->max)
+        {
+            stats->max = value;
+            stats->max_room = i;
+        }
+    }
+    stats->mean = count > 0 ? sum / count : 0;
+}
@@ -0,0 +1,57 @@
+#ifndef ROOM_STORE_H
+#define ROOM_STORE_H
+
+#include "pico/stdlib.h"
+#include "fixed_point.h"
+
+// Capacidade definida em tempo de compilação.
+#ifndef ROOM_STORE_CAPACITY
+#define ROOM_STORE_CAPACITY 64
+#endif
+#define ROOM_NAME_MAX 10        // Nome com terminador
+#define ROOM_NAME_POOL_SIZE 512 // Tabela de nomes internados
+
+// Ambientes organizados em vetores contíguos por métrica (estrutura de
+// vetores): varrer uma métrica em todos os ambientes lê memória sequencial.
+// Os nomes ficam em uma tabela separada, sem repetição, indexada por offset.
+typedef struct
+{
+    uint8_t count;
+    centi_t temperature[ROOM_STORE_CAPACITY]; // Centésimos de grau
+    centi_t humidity[ROOM_STORE_CAPACITY];    // Centésimos de porcento
+    uint32_t cam_on[(ROOM_STORE_CAPACITY + 31) / 32]; // Um bit por ambiente
+    uint16_t name_offset[ROOM_STORE_CAPACITY];
+    uint16_t names_used;
+    char names[ROOM_NAME_POOL_SIZE];
+} room_store_t;
+
+// Resumo de uma métrica sobre todos os ambientes.
+typedef struct
+{
+    centi_t min, max, mean;
+    uint8_t min_room, max_room;
+} room_stats_t;
+
+void room_store_init(room_store_t *store);
+int room_store_add(room_store_t *store, const char *name);
+void room_store_stats(const centi_t *values, uint8_t count, room_stats_t *stats);
+
+static inline const char *room_store_name(const room_store_t *store, uint8_t room)
+{
+    return &store->names[store->name_offset[room]];
+}
+
+static inline bool room_store_cam_on(const room_store_t *store, uint8_t room)
+{
+    return store->cam_on[room >> 5] & (1u << (room & 31));
+}
+
+static inline void room_store_set_cam(room_store_t *store, uint8_t room, bool on)
+{
+    if (on)
+        store->cam_on[room >> 5] |= 1u << (room & 31);
+    else
+        store->cam_on[room >> 5] &= ~(1u << (room & 31));
+}
+
+#endif // ROOM_STORE_H
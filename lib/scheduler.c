@@ -0,0 +1,86 @@
+#include "scheduler.h"
+#include "hardware/sync.h"
+
+// Prepara as tarefas; as periódicas executam pela primeira vez logo no início.
+void scheduler_init(scheduler_t *scheduler, task_t *tasks, uint8_t count)
+{
+    uint32_t now = time_us_32();
+
+    scheduler->tasks = tasks;
+    scheduler->count = count;
+    scheduler->busy_us = 0;
+    scheduler->idle_us = 0;
+    for (uint8_t i = 0; i < count; ++i)
+    {
+        tasks[i].next_us = now;
+        tasks[i].notified = 0;
+        tasks[i].handled = 0;
+        tasks[i].runs = 0;
+    }
+}
+
+// Marca a tarefa como pendente e acorda os núcleos. Pode ser chamada de ISRs
+// e do outro núcleo: notified != handled indica evento pendente, mesmo que
+// dois incrementos concorrentes se sobreponham.
+void scheduler_notify(task_t *task)
+{
+    task->notified++;
+    __sev();
+}
+
+// Executa a tarefa pendente de maior prioridade. Retorna false se nenhuma
+// estava pendente, preenchendo wait_us com o tempo até o próximo período.
+static bool scheduler_run_next(scheduler_t *scheduler, uint32_t *wait_us)
+{
+    uint32_t now = time_us_32();
+
+    *wait_us = UINT32_MAX;
+    for (uint8_t i = 0; i < scheduler->count; ++i)
+    {
+        task_t *task = &scheduler->tasks[i];
+        uint32_t notified = task->notified;
+        bool periodic_due = task->period_us != 0 && (int32_t)(now - task->next_us) >= 0;
+
+        if (notified != task->handled || periodic_due)
+        {
+            task->handled = notified;
+            if (task->period_us != 0)
+            {
+                // Mantém a cadência; se ficou para trás, recomeça a partir de agora
+                task->next_us += task->period_us;
+                if ((int32_t)(now - task->next_us) >= 0)
+                    task->next_us = now + task->period_us;
+            }
+
+            task->run();
+            task->runs++;
+            scheduler->busy_us += time_us_32() - now;
+            return true;
+        }
+
+        if (task->period_us != 0 && task->next_us - now < *wait_us)
+            *wait_us = task->next_us - now;
+    }
+
+    return false;
+}
+
+// Laço do escalonador; não retorna. Sem tarefas pendentes, o núcleo dorme em
+// WFE até o próximo período ou até uma interrupção/notificação (SEV).
+void scheduler_run(scheduler_t *scheduler)
+{
+    uint32_t wait_us;
+
+    while (true)
+    {
+        if (scheduler_run_next(scheduler, &wait_us))
+            continue;
+
+        uint32_t idle_start_us = time_us_32();
+        if (wait_us == UINT32_MAX)
+            __wfe();
+        else
+            best_effort_wfe_or_timeout(delayed_by_us(get_absolute_time(), wait_us));
+        scheduler->idle_us += time_us_32() - idle_start_us;
+    }
+}
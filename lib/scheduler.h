@@ -0,0 +1,36 @@
+#ifndef SCHEDULER_H
+#define SCHEDULER_H
+
+#include "pico/stdlib.h"
+
+// Tarefa cooperativa: executa a cada period_us (0: apenas por evento) e
+// também quando notificada por scheduler_notify (ISR ou outro núcleo).
+typedef struct
+{
+    const char *name;
+    void (*run)(void);
+    uint32_t period_us;
+    uint32_t next_us;
+    volatile uint32_t notified; // Incrementado por quem notifica
+    uint32_t handled;           // Última notificação atendida
+    uint32_t runs;
+} task_t;
+
+#define TASK(task_name, function, period_ms) \
+    { .name = (task_name), .run = (function), .period_us = (period_ms) * 1000u }
+
+// Escalonador de um núcleo: as tarefas são verificadas em ordem de prioridade
+// (posição na tabela) e o núcleo dorme quando nenhuma está pendente.
+typedef struct
+{
+    task_t *tasks;
+    uint8_t count;
+    volatile uint32_t busy_us; // Tempo acumulado executando tarefas
+    volatile uint32_t idle_us; // Tempo acumulado dormindo
+} scheduler_t;
+
+void scheduler_init(scheduler_t *scheduler, task_t *tasks, uint8_t count);
+void scheduler_notify(task_t *task);
+void scheduler_run(scheduler_t *scheduler);
+
+#endif // SCHEDULER_H
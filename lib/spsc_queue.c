@@ -0,0 +1,43 @@
+#include <string.h>
+#include "spsc_queue.h"
+#include "hardware/sync.h"
+
+// Inicializa a fila sobre um buffer de capacity itens de item_size bytes.
+void spsc_queue_init(spsc_queue_t *queue, void *buffer, uint16_t item_size, uint16_t capacity)
+{
+    queue->buffer = buffer;
+    queue->item_size = item_size;
+    queue->capacity = capacity;
+    queue->head = 0;
+    queue->tail = 0;
+}
+
+// Produtor: copia o item para a fila. Retorna false se estiver cheia.
+bool spsc_queue_push(spsc_queue_t *queue, const void *item)
+{
+    uint32_t head = queue->head;
+
+    if (head - queue->tail >= queue->capacity)
+        return false;
+
+    memcpy(&queue->buffer[(head % queue->capacity) * queue->item_size], item, queue->item_size);
+    __dmb(); // O item fica visível antes do novo head
+    queue->head = head + 1;
+    __sev(); // Acorda o consumidor em __wfe
+    return true;
+}
+
+// Consumidor: retira o item mais antigo. Retorna false se estiver vazia.
+bool spsc_queue_pop(spsc_queue_t *queue, void *item)
+{
+    uint32_t tail = queue->tail;
+
+    if (queue->head == tail)
+        return false;
+
+    __dmb(); // Lê o item somente após observar o head
+    memcpy(item, &queue->buffer[(tail % queue->capacity) * queue->item_size], queue->item_size);
+    __dmb(); // Termina a leitura antes de liberar a posição
+    queue->tail = tail + 1;
+    return true;
+}
@@ -0,0 +1,22 @@
+#ifndef SPSC_QUEUE_H
+#define SPSC_QUEUE_H
+
+#include "pico/stdlib.h"
+
+// Fila sem trava para um produtor e um consumidor (ex.: um em cada núcleo).
+// head só é escrito pelo produtor e tail só pelo consumidor; os índices
+// crescem livremente e são reduzidos módulo capacity no acesso.
+typedef struct
+{
+    uint8_t *buffer;
+    uint16_t item_size;
+    uint16_t capacity;
+    volatile uint32_t head;
+    volatile uint32_t tail;
+} spsc_queue_t;
+
+void spsc_queue_init(spsc_queue_t *queue, void *buffer, uint16_t item_size, uint16_t capacity);
+bool spsc_queue_push(spsc_queue_t *queue, const void *item);
+bool spsc_queue_pop(spsc_queue_t *queue, void *item);
+
+#endif // SPSC_QUEUE_H
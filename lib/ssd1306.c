@@ -1,47 +1,166 @@
+#include <string.h>
 #include "ssd1306.h"
-#include "font.h"
+#include "hardware/dma.h"
+#include "hardware/irq.h"
+#include "hardware/clocks.h"
 
-void ssd1306_init(ssd1306_t *ssd, uint8_t width, uint8_t height, bool external_vcc, uint8_t address, i2c_inst_t *i2c) {
+// Display servido pela interrupção de DMA (o driver suporta um display com DMA)
+static ssd1306_t *ssd1306_dma_owner = NULL;
+
+// Fim do DMA: o último byte do frame entrou no FIFO do I2C. O barramento só
+// fica livre depois que o FIFO esvazia, então o tempo de barramento soma a
+// vazão do que resta nele (9 pulsos de SCL por byte, mais o byte em curso).
+// Os dois tempos publicados são do mesmo frame, o que acabou de terminar.
+static void ssd1306_dma_irq_handler(void) {
+  ssd1306_t *ssd = ssd1306_dma_owner;
+  if (ssd != NULL && dma_channel_get_irq1_status(ssd->dma_chan)) {
+    dma_channel_acknowledge_irq1(ssd->dma_chan);
+    uint32_t drain_us = (i2c_get_hw(ssd->i2c_port)->txflr + 1) * 9 * ssd->scl_period_ns / 1000;
+    ssd->send_busy_us = time_us_32() - ssd->send_start_us + drain_us;
+    ssd->send_cpu_us = ssd->tx_cpu_us;
+  }
+}
+
+// Os buffers vêm de armazenamento estático do chamador (sem heap); width x height
+// não pode exceder WIDTH x HEIGHT, para o qual ssd1306_buffers_t é dimensionado.
+void ssd1306_init(ssd1306_t *ssd, uint8_t width, uint8_t height, bool external_vcc, uint8_t address, i2c_inst_t *i2c,
+                  ssd1306_buffers_t *buffers) {
   ssd->width = width;
   ssd->height = height;
   ssd->pages = height / 8U;
   ssd->address = address;
   ssd->i2c_port = i2c;
   ssd->bufsize = ssd->pages * ssd->width + 1;
-  ssd->ram_buffer = calloc(ssd->bufsize, sizeof(uint8_t));
+  ssd->ram_buffer = buffers->back;
+  ssd->front_buffer = buffers->front;
+  ssd->tx_buffer = buffers->tx;
+  memset(ssd->ram_buffer, 0, ssd->bufsize);
+  memset(ssd->front_buffer, 0, ssd->bufsize);
   ssd->ram_buffer[0] = 0x40;
   ssd->port_buffer[0] = 0x80;
+  ssd->frame_bytes = 0;
+  ssd->total_bytes = 0;
+  ssd->frames_sent = 0;
+  ssd->send_cpu_us = 0;
+  ssd->send_busy_us = 0;
+  ssd->send_start_us = 0;
+  ssd->tx_cpu_us = 0;
+  ssd->sending = false;
+  ssd->dirty_manual = false;
+
+  // Período do SCL configurado por i2c_init (chamar antes): HCNT + LCNT ciclos de clk_peri
+  i2c_hw_t *hw = i2c_get_hw(i2c);
+  ssd->scl_period_ns = (uint32_t)((hw->fs_scl_hcnt + hw->fs_scl_lcnt) * 1000000000ull / clock_get_hz(clk_peri));
+
+  // Canal DMA que alimenta o FIFO de transmissão do I2C com o frame
+  ssd->dma_chan = dma_claim_unused_channel(true);
+  dma_channel_config c = dma_channel_get_default_config(ssd->dma_chan);
+  channel_config_set_transfer_data_size(&c, DMA_SIZE_16);
+  channel_config_set_read_increment(&c, true);
+  channel_config_set_write_increment(&c, false);
+  channel_config_set_dreq(&c, i2c_get_dreq(i2c, true));
+  dma_channel_configure(ssd->dma_chan, &c, &i2c_get_hw(i2c)->data_cmd, ssd->tx_buffer, 0, false);
+
+  ssd1306_dma_owner = ssd;
+  dma_channel_set_irq1_enabled(ssd->dma_chan, true);
+  irq_add_shared_handler(DMA_IRQ_1, ssd1306_dma_irq_handler, PICO_SHARED_IRQ_HANDLER_DEFAULT_ORDER_PRIORITY);
+  irq_set_enabled(DMA_IRQ_1, true);
+
+  ssd1306_invalidate(ssd);
+}
+
+static inline void ssd1306_window_merge(ssd1306_window_t *w, uint8_t col0, uint8_t col1, uint8_t page0, uint8_t page1) {
+  if (col0 < w->col0) w->col0 = col0;
+  if (col1 > w->col1) w->col1 = col1;
+  if (page0 < w->page0) w->page0 = page0;
+  if (page1 > w->page1) w->page1 = page1;
+}
+
+static inline uint16_t ssd1306_window_area(const ssd1306_window_t *w) {
+  return (uint16_t)(w->col1 - w->col0 + 1) * (w->page1 - w->page0 + 1);
+}
+
+// Acrescenta uma janela de colunas/páginas alterada. Une a uma janela que
+// ela sobrepõe ou toca; senão ocupa uma nova e, sem janela livre, une à que
+// menos cresce.
+static void ssd1306_add_dirty(ssd1306_t *ssd, uint8_t col0, uint8_t col1, uint8_t page0, uint8_t page1) {
+  for (uint8_t i = 0; i < ssd->dirty_count; ++i) {
+    ssd1306_window_t *w = &ssd->dirty[i];
+    if (col0 <= w->col1 + 1 && col1 + 1 >= w->col0 && page0 <= w->page1 + 1 && page1 + 1 >= w->page0) {
+      ssd1306_window_merge(w, col0, col1, page0, page1);
+      return;
+    }
+  }
+
+  if (ssd->dirty_count < SSD1306_DIRTY_WINDOWS) {
+    ssd->dirty[ssd->dirty_count++] = (ssd1306_window_t){col0, col1, page0, page1};
+    return;
+  }
+
+  uint8_t best = 0;
+  uint16_t best_growth = UINT16_MAX;
+  for (uint8_t i = 0; i < ssd->dirty_count; ++i) {
+    ssd1306_window_t merged = ssd->dirty[i];
+    ssd1306_window_merge(&merged, col0, col1, page0, page1);
+    uint16_t growth = ssd1306_window_area(&merged) - ssd1306_window_area(&ssd->dirty[i]);
+    if (growth < best_growth) {
+      best = i;
+      best_growth = growth;
+    }
+  }
+  ssd1306_window_merge(&ssd->dirty[best], col0, col1, page0, page1);
+}
+
+// Marca a janela desenhada por uma primitiva, exceto quando o chamador
+// informa as regiões por conta própria (dirty_manual)
+static inline void ssd1306_mark_dirty(ssd1306_t *ssd, uint8_t col0, uint8_t col1, uint8_t page0, uint8_t page1) {
+  if (!ssd->dirty_manual)
+    ssd1306_add_dirty(ssd, col0, col1, page0, page1);
 }
 
+// Informa uma região alterada (em pixels): escrita fora das primitivas de
+// desenho ou, com dirty_manual, a caixa do que o chamador redesenhou
+void ssd1306_mark_dirty_rect(ssd1306_t *ssd, uint8_t x, uint8_t y, uint8_t width, uint8_t height) {
+  if (width == 0 || height == 0 || x >= ssd->width || y >= ssd->height)
+    return;
+  uint8_t right = x + width - 1 < ssd->width ? x + width - 1 : ssd->width - 1;
+  uint8_t bottom = y + height - 1 < ssd->height ? y + height - 1 : ssd->height - 1;
+  ssd1306_add_dirty(ssd, x, right, y >> 3, bottom >> 3);
+}
+
+// Descarta o front buffer (cópia do painel), forçando o reenvio completo no próximo frame
+void ssd1306_invalidate(ssd1306_t *ssd) {
+  ssd->front_valid = false;
+  ssd->dirty_count = 0;
+  ssd1306_add_dirty(ssd, 0, ssd->width - 1, 0, ssd->pages - 1);
+}
+
+// Sequência de inicialização, enviada em uma única transação I2C
+static const uint8_t ssd1306_config_cmds[] = {
+  SET_DISP | 0x00,
+  SET_MEM_ADDR, 0x01,
+  SET_DISP_START_LINE | 0x00,
+  SET_SEG_REMAP | 0x01,
+  SET_MUX_RATIO, HEIGHT - 1,
+  SET_COM_OUT_DIR | 0x08,
+  SET_DISP_OFFSET, 0x00,
+  SET_COM_PIN_CFG, 0x12,
+  SET_DISP_CLK_DIV, 0x80,
+  SET_PRECHARGE, 0xF1,
+  SET_VCOM_DESEL, 0x30,
+  SET_CONTRAST, 0xFF,
+  SET_ENTIRE_ON,
+  SET_NORM_INV,
+  SET_CHARGE_PUMP, 0x14,
+  SET_DISP | 0x01
+};
+
 void ssd1306_config(ssd1306_t *ssd) {
-  ssd1306_command(ssd, SET_DISP | 0x00);
-  ssd1306_command(ssd, SET_MEM_ADDR);
-  ssd1306_command(ssd, 0x01);
-  ssd1306_command(ssd, SET_DISP_START_LINE | 0x00);
-  ssd1306_command(ssd, SET_SEG_REMAP | 0x01);
-  ssd1306_command(ssd, SET_MUX_RATIO);
-  ssd1306_command(ssd, HEIGHT - 1);
-  ssd1306_command(ssd, SET_COM_OUT_DIR | 0x08);
-  ssd1306_command(ssd, SET_DISP_OFFSET);
-  ssd1306_command(ssd, 0x00);
-  ssd1306_command(ssd, SET_COM_PIN_CFG);
-  ssd1306_command(ssd, 0x12);
-  ssd1306_command(ssd, SET_DISP_CLK_DIV);
-  ssd1306_command(ssd, 0x80);
-  ssd1306_command(ssd, SET_PRECHARGE);
-  ssd1306_command(ssd, 0xF1);
-  ssd1306_command(ssd, SET_VCOM_DESEL);
-  ssd1306_command(ssd, 0x30);
-  ssd1306_command(ssd, SET_CONTRAST);
-  ssd1306_command(ssd, 0xFF);
-  ssd1306_command(ssd, SET_ENTIRE_ON);
-  ssd1306_command(ssd, SET_NORM_INV);
-  ssd1306_command(ssd, SET_CHARGE_PUMP);
-  ssd1306_command(ssd, 0x14);
-  ssd1306_command(ssd, SET_DISP | 0x01);
+  ssd1306_command_list(ssd, ssd1306_config_cmds, sizeof(ssd1306_config_cmds));
 }
 
 void ssd1306_command(ssd1306_t *ssd, uint8_t command) {
+  ssd1306_wait_send(ssd); // Não mistura comandos com um frame em andamento
   ssd->port_buffer[1] = command;
   i2c_write_blocking(
     ssd->i2c_port,
@@ -52,24 +171,174 @@ void ssd1306_command(ssd1306_t *ssd, uint8_t command) {
   );
 }
 
+// Envia uma lista de comandos em uma única transação: o byte de controle
+// 0x00 (Co = 0, D/C = 0) faz o controlador tratar todos os bytes seguintes
+// como comandos até o STOP.
+void ssd1306_command_list(ssd1306_t *ssd, const uint8_t *commands, size_t count) {
+  uint8_t buffer[SSD1306_CMD_LIST_MAX + 1];
+
+  ssd1306_wait_send(ssd);
+  buffer[0] = 0x00;
+  while (count > 0) {
+    size_t chunk = count > SSD1306_CMD_LIST_MAX ? SSD1306_CMD_LIST_MAX : count;
+    memcpy(&buffer[1], commands, chunk);
+    i2c_write_blocking(
+      ssd->i2c_port,
+      ssd->address,
+      buffer,
+      chunk + 1,
+      false
+    );
+    commands += chunk;
+    count -= chunk;
+  }
+}
+
+// Adiciona um byte ao fluxo do DMA; stop encerra a transação I2C nele
+static inline void ssd1306_tx_push(ssd1306_t *ssd, size_t *len, uint8_t byte, bool stop) {
+  ssd->tx_buffer[(*len)++] = byte | (stop ? I2C_IC_DATA_CMD_STOP_BITS : 0);
+}
+
+// Indica se ainda há um frame sendo transmitido
+bool ssd1306_send_busy(ssd1306_t *ssd) {
+  if (!ssd->sending)
+    return false;
+
+  i2c_hw_t *hw = i2c_get_hw(ssd->i2c_port);
+
+  // NACK do display: o hardware descarta o FIFO, então aborta o DMA
+  if (hw->raw_intr_stat & I2C_IC_RAW_INTR_STAT_TX_ABRT_BITS) {
+    dma_channel_abort(ssd->dma_chan);
+    (void)hw->clr_tx_abrt;
+    ssd1306_invalidate(ssd);
+  } else if (dma_channel_is_busy(ssd->dma_chan) || !(hw->status & I2C_IC_STATUS_TFE_BITS) ||
+             (hw->status & I2C_IC_STATUS_MST_ACTIVITY_BITS)) {
+    return true;
+  }
+
+  ssd->sending = false;
+  return false;
+}
+
+// Aguarda o fim do frame em andamento
+void ssd1306_wait_send(ssd1306_t *ssd) {
+  while (ssd1306_send_busy(ssd))
+    tight_loop_contents();
+}
+
+// Reduz a janela aos bytes do back buffer que diferem do front buffer
+// (painel). Retorna false se nada mudou nela.
+static bool ssd1306_window_reduce(ssd1306_t *ssd, ssd1306_window_t *w) {
+  uint8_t c_min = 0xFF, c_max = 0, p_min = 0xFF, p_max = 0;
+  for (uint8_t x = w->col0; x <= w->col1; ++x) {
+    uint16_t base = 1 + x * ssd->pages;
+    for (uint8_t p = w->page0; p <= w->page1; ++p) {
+      if (ssd->ram_buffer[base + p] != ssd->front_buffer[base + p]) {
+        if (x < c_min) c_min = x;
+        if (x > c_max) c_max = x;
+        if (p < p_min) p_min = p;
+        if (p > p_max) p_max = p;
+      }
+    }
+  }
+  if (c_min == 0xFF)
+    return false;
+
+  *w = (ssd1306_window_t){c_min, c_max, p_min, p_max};
+  return true;
+}
+
+// Acrescenta ao fluxo do DMA a transação de comandos da janela (0x00, cmd...)
+// e a de dados (0x40, bytes), copiando os dados também para o front buffer
+static void ssd1306_tx_window(ssd1306_t *ssd, size_t *len, const ssd1306_window_t *w) {
+  const uint8_t window[6] = {SET_COL_ADDR, w->col0, w->col1, SET_PAGE_ADDR, w->page0, w->page1};
+  ssd1306_tx_push(ssd, len, 0x00, false);
+  for (uint8_t i = 0; i < 6; ++i)
+    ssd1306_tx_push(ssd, len, window[i], i == 5);
+
+  ssd1306_tx_push(ssd, len, 0x40, false);
+  for (uint8_t x = w->col0; x <= w->col1; ++x) {
+    uint16_t base = 1 + x * ssd->pages;
+    for (uint8_t p = w->page0; p <= w->page1; ++p) {
+      ssd1306_tx_push(ssd, len, ssd->ram_buffer[base + p], x == w->col1 && p == w->page1);
+      ssd->front_buffer[base + p] = ssd->ram_buffer[base + p];
+    }
+  }
+}
+
+// Inicia o envio, via DMA, apenas das janelas que diferem do conteúdo atual
+// do painel, cada uma em suas transações. O buffer usa endereçamento
+// vertical: índice = 1 + coluna * páginas + página. Os dados são copiados
+// para tx_buffer, então ram_buffer pode ser redesenhado logo após o retorno.
+// Retorna false se o frame anterior ainda está em envio.
+bool ssd1306_send_data_async(ssd1306_t *ssd) {
+  if (ssd1306_send_busy(ssd))
+    return false;
+
+  uint32_t start_us = time_us_32();
+  ssd->frame_bytes = 0;
+  if (ssd->dirty_count == 0)
+    return true;
+
+  // Janelas sobrepostas que somam mais que a tela viram uma só, para o fluxo caber em tx_buffer
+  uint16_t area = 0;
+  for (uint8_t i = 0; i < ssd->dirty_count; ++i)
+    area += ssd1306_window_area(&ssd->dirty[i]);
+  if (area > ssd->width * ssd->pages) {
+    for (uint8_t i = 1; i < ssd->dirty_count; ++i)
+      ssd1306_window_merge(&ssd->dirty[0], ssd->dirty[i].col0, ssd->dirty[i].col1, ssd->dirty[i].page0,
+                           ssd->dirty[i].page1);
+    ssd->dirty_count = 1;
+  }
+
+  size_t len = 0;
+  for (uint8_t i = 0; i < ssd->dirty_count; ++i) {
+    ssd1306_window_t w = ssd->dirty[i];
+    if (!ssd->front_valid || ssd1306_window_reduce(ssd, &w))
+      ssd1306_tx_window(ssd, &len, &w);
+  }
+  ssd->dirty_count = 0;
+  ssd->front_valid = true;
+  if (len == 0)
+    return true; // Nada mudou: nenhum tráfego no barramento
+
+  // Define o endereço do escravo e entrega o fluxo ao DMA
+  i2c_hw_t *hw = i2c_get_hw(ssd->i2c_port);
+  hw->enable = 0;
+  hw->tar = ssd->address;
+  hw->enable = 1;
+  ssd->sending = true;
+  ssd->send_start_us = start_us;
+  ssd->tx_cpu_us = time_us_32() - start_us; // Antes do DMA: a interrupção pode vir logo em seguida
+  dma_channel_transfer_from_buffer_now(ssd->dma_chan, ssd->tx_buffer, len);
+
+  ssd->frame_bytes = len;
+  ssd->total_bytes += len;
+  ssd->frames_sent++;
+  return true;
+}
+
+// Troca de buffers: entrega o back buffer concluído ao transporte. Espera
+// apenas o frame anterior terminar (nunca sobrescreve um frame em envio) e
+// retorna assim que o novo frame é entregue ao DMA. O back buffer mantém
+// o conteúdo e pode ser redesenhado imediatamente.
+void ssd1306_flip(ssd1306_t *ssd) {
+  ssd1306_wait_send(ssd);
+  ssd1306_send_data_async(ssd);
+}
+
+// Versão bloqueante: envia a janela alterada e aguarda o fim da transmissão
 void ssd1306_send_data(ssd1306_t *ssd) {
-  ssd1306_command(ssd, SET_COL_ADDR);
-  ssd1306_command(ssd, 0);
-  ssd1306_command(ssd, ssd->width - 1);
-  ssd1306_command(ssd, SET_PAGE_ADDR);
-  ssd1306_command(ssd, 0);
-  ssd1306_command(ssd, ssd->pages - 1);
-  i2c_write_blocking(
-    ssd->i2c_port,
-    ssd->address,
-    ssd->ram_buffer,
-    ssd->bufsize,
-    false
-  );
+  ssd1306_wait_send(ssd);
+  ssd1306_send_data_async(ssd);
+  ssd1306_wait_send(ssd);
 }
 
 void ssd1306_pixel(ssd1306_t *ssd, uint8_t x, uint8_t y, bool value) {
-  uint16_t index = (y >> 3) + (x << 3) + 1;
+  if (x >= ssd->width || y >= ssd->height)
+    return;
+  ssd1306_mark_dirty(ssd, x, x, y >> 3, y >> 3);
+  uint16_t index = (y >> 3) + x * ssd->pages + 1;
   uint8_t pixel = (y & 0b111);
   if (value)
     ssd->ram_buffer[index] |= (1 << pixel);
@@ -77,42 +346,61 @@ void ssd1306_pixel(ssd1306_t *ssd, uint8_t x, uint8_t y, bool value) {
     ssd->ram_buffer[index] &= ~(1 << pixel);
 }
 
-/*
-void ssd1306_fill(ssd1306_t *ssd, bool value) {
-  uint8_t byte = value ? 0xFF : 0x00;
-  for (uint8_t i = 1; i < ssd->bufsize; ++i)
-    ssd->ram_buffer[i] = byte;
-}*/
+// Liga/desliga os bits y0..y1 (inclusivos) de uma coluna, um byte por página.
+// Não valida limites nem marca a região suja: responsabilidade de quem chama.
+static inline void ssd1306_column_span(ssd1306_t *ssd, uint8_t x, uint8_t y0, uint8_t y1, bool value) {
+  uint8_t *column = &ssd->ram_buffer[1 + x * ssd->pages];
+  uint8_t page0 = y0 >> 3, page1 = y1 >> 3;
+
+  for (uint8_t p = page0; p <= page1; ++p) {
+    uint8_t mask = 0xFF;
+    if (p == page0) mask &= 0xFF << (y0 & 7);
+    if (p == page1) mask &= 0xFF >> (7 - (y1 & 7));
+    if (value)
+      column[p] |= mask;
+    else
+      column[p] &= ~mask;
+  }
+}
 
 void ssd1306_fill(ssd1306_t *ssd, bool value) {
-    // Itera por todas as posições do display
-    for (uint8_t y = 0; y < ssd->height; ++y) {
-        for (uint8_t x = 0; x < ssd->width; ++x) {
-            ssd1306_pixel(ssd, x, y, value);
-        }
-    }
+  memset(&ssd->ram_buffer[1], value ? 0xFF : 0x00, ssd->bufsize - 1);
+  ssd1306_mark_dirty(ssd, 0, ssd->width - 1, 0, ssd->pages - 1);
 }
 
 void ssd1306_rect(ssd1306_t *ssd, uint8_t top, uint8_t left, uint8_t width, uint8_t height, bool value, bool fill) {
-  for (uint8_t x = left; x < left + width; ++x) {
-    ssd1306_pixel(ssd, x, top, value);
-    ssd1306_pixel(ssd, x, top + height - 1, value);
-  }
-  for (uint8_t y = top; y < top + height; ++y) {
-    ssd1306_pixel(ssd, left, y, value);
-    ssd1306_pixel(ssd, left + width - 1, y, value);
-  }
+  if (width == 0 || height == 0)
+    return;
+
+  uint8_t right = left + width - 1 < ssd->width ? left + width - 1 : ssd->width - 1;
+  uint8_t bottom = top + height - 1 < ssd->height ? top + height - 1 : ssd->height - 1;
 
   if (fill) {
-    for (uint8_t x = left + 1; x < left + width - 1; ++x) {
-      for (uint8_t y = top + 1; y < top + height - 1; ++y) {
-        ssd1306_pixel(ssd, x, y, value);
-      }
-    }
+    if (left >= ssd->width || top >= ssd->height)
+      return;
+    for (uint8_t x = left; x <= right; ++x)
+      ssd1306_column_span(ssd, x, top, bottom, value);
+    ssd1306_mark_dirty(ssd, left, right, top >> 3, bottom >> 3);
+    return;
   }
+
+  ssd1306_hline(ssd, left, left + width - 1, top, value);
+  ssd1306_hline(ssd, left, left + width - 1, top + height - 1, value);
+  ssd1306_vline(ssd, left, top, top + height - 1, value);
+  ssd1306_vline(ssd, left + width - 1, top, top + height - 1, value);
 }
 
 void ssd1306_line(ssd1306_t *ssd, uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1, bool value) {
+    // Linhas retas usam os caminhos por byte
+    if (y0 == y1) {
+        ssd1306_hline(ssd, x0 < x1 ? x0 : x1, x0 < x1 ? x1 : x0, y0, value);
+        return;
+    }
+    if (x0 == x1) {
+        ssd1306_vline(ssd, x0, y0 < y1 ? y0 : y1, y0 < y1 ? y1 : y0, value);
+        return;
+    }
+
     int dx = abs(x1 - x0);
     int dy = abs(y1 - y0);
 
@@ -141,60 +429,99 @@ void ssd1306_line(ssd1306_t *ssd, uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1
 }
 
 void ssd1306_hline(ssd1306_t *ssd, uint8_t x0, uint8_t x1, uint8_t y, bool value) {
-  for (uint8_t x = x0; x <= x1; ++x)
-    ssd1306_pixel(ssd, x, y, value);
+  if (y >= ssd->height || x0 >= ssd->width || x0 > x1)
+    return;
+  if (x1 >= ssd->width)
+    x1 = ssd->width - 1;
+
+  // Mesmo bit da mesma página em cada coluna: avança uma coluna por vez
+  uint8_t *byte = &ssd->ram_buffer[1 + x0 * ssd->pages + (y >> 3)];
+  uint8_t mask = 1 << (y & 7);
+  for (uint8_t x = x0; x <= x1; ++x, byte += ssd->pages) {
+    if (value)
+      *byte |= mask;
+    else
+      *byte &= ~mask;
+  }
+  ssd1306_mark_dirty(ssd, x0, x1, y >> 3, y >> 3);
 }
 
 void ssd1306_vline(ssd1306_t *ssd, uint8_t x, uint8_t y0, uint8_t y1, bool value) {
-  for (uint8_t y = y0; y <= y1; ++y)
-    ssd1306_pixel(ssd, x, y, value);
+  if (x >= ssd->width || y0 >= ssd->height || y0 > y1)
+    return;
+  if (y1 >= ssd->height)
+    y1 = ssd->height - 1;
+
+  ssd1306_column_span(ssd, x, y0, y1, value);
+  ssd1306_mark_dirty(ssd, x, x, y0 >> 3, y1 >> 3);
 }
 
-// Função para desenhar um caractere
-void ssd1306_draw_char(ssd1306_t *ssd, char c, uint8_t x, uint8_t y)
+// Função para desenhar um glifo da fonte. Cada byte do glifo é uma página de
+// uma coluna, no mesmo formato do display: com y múltiplo de 8 o glifo é
+// copiado byte a byte; caso contrário, cada byte é dividido em duas escritas
+// deslocadas e mascaradas nas páginas vizinhas.
+void ssd1306_draw_glyph(ssd1306_t *ssd, const font_t *font, uint8_t code, uint8_t x, uint8_t y)
 {
-  uint16_t index = 0;
-  char ver=c;
-
-  if (c >= 'A' && c <= 'Z') {
-    index = (c - 'A' + 11) * 8; // Letras maiúsculas
-  } else if (c >= '0' && c <= '9') {
-      index = (c - '0' + 1) * 8;  // Números
-  } else if (c >= 'a' && c <= 'z') {
-      index = (c - 'a' + 37) * 8; // Letras minúsculas
-    } else if (c == '%') {          // Caractere '%'
-        index = 63 * 8;             // Índice 63
-  } else if (c == 0xB0) {          // Caractere '°'
-      index = 64 * 8;             // Índice 64
-  } else if (c == ':') {          // Caractere ':'
-      index = 65 * 8;             // Índice 65
-  } 
-
-  for (uint8_t i = 0; i < 8; ++i)
+  if (x >= ssd->width || y >= ssd->height)
+    return;
+
+  const uint8_t *glyph = font_glyph(font, code);
+  uint8_t columns = ssd->width - x < font->width ? ssd->width - x : font->width;
+  uint8_t page = y >> 3;
+  uint8_t shift = y & 7;
+  uint8_t last = page + font->pages - (shift == 0); // Última página tocada
+  if (last >= ssd->pages)
+    last = ssd->pages - 1;
+  uint8_t *dst = &ssd->ram_buffer[1 + x * ssd->pages];
+
+  for (uint8_t i = 0; i < columns; ++i, dst += ssd->pages, glyph += font->pages)
   {
-    uint8_t line = font[index + i];
-    for (uint8_t j = 0; j < 8; ++j)
+    for (uint8_t p = 0; p < font->pages && page + p <= last; ++p)
     {
-      ssd1306_pixel(ssd, x + i, y + j, line & (1 << j));
+      uint8_t line = glyph[p];
+      uint8_t target = page + p;
+      if (shift == 0) {
+        dst[target] = line;
+      } else {
+        dst[target] = (dst[target] & (0xFF >> (8 - shift))) | (uint8_t)(line << shift);
+        if (target < last)
+          dst[target + 1] = (dst[target + 1] & (0xFF << shift)) | (line >> (8 - shift));
+      }
     }
   }
+  ssd1306_mark_dirty(ssd, x, x + columns - 1, page, last);
 }
 
-// Função para desenhar uma string
-void ssd1306_draw_string(ssd1306_t *ssd, const char *str, uint8_t x, uint8_t y)
+// Função para desenhar uma string UTF-8 com a fonte, quebrando a linha
+// quando o próximo caractere não cabe inteiro na largura do display
+void ssd1306_draw_string_font(ssd1306_t *ssd, const font_t *font, const char *str, uint8_t x, uint8_t y)
 {
+  uint8_t height = font->pages * 8;
+
   while (*str)
   {
-    ssd1306_draw_char(ssd, *str++, x, y);
-    x += 8;
-    if (x + 8 >= ssd->width)
+    ssd1306_draw_glyph(ssd, font, font_next_code(&str), x, y);
+    x += font->width;
+    if (x + font->width > ssd->width)
     {
       x = 0;
-      y += 8;
+      y += height;
     }
-    if (y + 8 >= ssd->height)
+    if (y + height > ssd->height)
     {
       break;
     }
   }
 }
+
+// Função para desenhar um caractere com a fonte 8x8
+void ssd1306_draw_char(ssd1306_t *ssd, char c, uint8_t x, uint8_t y)
+{
+  ssd1306_draw_glyph(ssd, &font_small, (uint8_t)c, x, y);
+}
+
+// Função para desenhar uma string com a fonte 8x8
+void ssd1306_draw_string(ssd1306_t *ssd, const char *str, uint8_t x, uint8_t y)
+{
+  ssd1306_draw_string_font(ssd, &font_small, str, x, y);
+}
@@ -4,9 +4,14 @@
 #include <stdlib.h>
 #include "pico/stdlib.h"
 #include "hardware/i2c.h"
+#include "font.h"
 
 #define WIDTH 128
 #define HEIGHT 64
+#define SSD1306_CMD_LIST_MAX 32 // Comandos por transação em ssd1306_command_list
+#define SSD1306_BUFSIZE (WIDTH * (HEIGHT / 8) + 1) // Byte 0x40 + pixels
+#define SSD1306_WINDOW_CMD_WORDS 7 // Transação de comandos (0x00 + 6 comandos) antes dos dados
+#define SSD1306_DIRTY_WINDOWS 4 // Janelas sujas separadas, cada uma enviada em sua própria transação
 
 typedef enum {
   SET_CONTRAST = 0x81,
@@ -28,19 +33,62 @@ typedef enum {
   SET_CHARGE_PUMP = 0x8D
 } ssd1306_command_t;
 
+// Armazenamento dos buffers, alocado estaticamente pelo chamador
+typedef struct {
+  uint8_t back[SSD1306_BUFSIZE];  // Onde a aplicação desenha
+  uint8_t front[SSD1306_BUFSIZE]; // O que o painel está exibindo
+  // Frame em envio pelo DMA: dados + comandos e byte 0x40 de cada janela
+  uint16_t tx[SSD1306_BUFSIZE + SSD1306_DIRTY_WINDOWS * (SSD1306_WINDOW_CMD_WORDS + 1)];
+} ssd1306_buffers_t;
+
+// Janela do display em colunas e páginas (inclusivas)
+typedef struct {
+  uint8_t col0, col1;
+  uint8_t page0, page1;
+} ssd1306_window_t;
+
 typedef struct {
   uint8_t width, height, pages, address;
   i2c_inst_t *i2c_port;
   bool external_vcc;
-  uint8_t *ram_buffer;
+  uint8_t *ram_buffer; // Back buffer
   size_t bufsize;
   uint8_t port_buffer[2];
+  // Front buffer (conteúdo do painel) e fluxo para o DMA (byte + bit de STOP do I2C)
+  uint8_t *front_buffer;
+  uint16_t *tx_buffer;
+  bool front_valid;
+  // Janelas sujas desde o último envio; regiões que se tocam são unidas
+  ssd1306_window_t dirty[SSD1306_DIRTY_WINDOWS];
+  uint8_t dirty_count;
+  bool dirty_manual; // Primitivas não marcam: o chamador informa as regiões (ssd1306_mark_dirty_rect)
+  // Contadores de bytes enviados pelo I2C
+  uint32_t frame_bytes;
+  uint32_t total_bytes;
+  uint32_t frames_sent;
+  // Envio assíncrono via DMA
+  int dma_chan;
+  bool sending;
+  uint32_t send_start_us;
+  uint32_t tx_cpu_us;    // Tempo de CPU do frame em envio
+  uint32_t scl_period_ns;
+  // Último frame concluído: CPU para prepará-lo e barramento até esvaziar o FIFO
+  volatile uint32_t send_cpu_us;
+  volatile uint32_t send_busy_us;
 } ssd1306_t;
 
-void ssd1306_init(ssd1306_t *ssd, uint8_t width, uint8_t height, bool external_vcc, uint8_t address, i2c_inst_t *i2c);
+void ssd1306_init(ssd1306_t *ssd, uint8_t width, uint8_t height, bool external_vcc, uint8_t address, i2c_inst_t *i2c,
+                  ssd1306_buffers_t *buffers);
 void ssd1306_config(ssd1306_t *ssd);
 void ssd1306_command(ssd1306_t *ssd, uint8_t command);
+void ssd1306_command_list(ssd1306_t *ssd, const uint8_t *commands, size_t count);
 void ssd1306_send_data(ssd1306_t *ssd);
+bool ssd1306_send_data_async(ssd1306_t *ssd);
+void ssd1306_flip(ssd1306_t *ssd);
+bool ssd1306_send_busy(ssd1306_t *ssd);
+void ssd1306_wait_send(ssd1306_t *ssd);
+void ssd1306_invalidate(ssd1306_t *ssd);
+void ssd1306_mark_dirty_rect(ssd1306_t *ssd, uint8_t x, uint8_t y, uint8_t width, uint8_t height);
 
 void ssd1306_pixel(ssd1306_t *ssd, uint8_t x, uint8_t y, bool value);
 void ssd1306_fill(ssd1306_t *ssd, bool value);
@@ -48,7 +96,9 @@ void ssd1306_rect(ssd1306_t *ssd, uint8_t top, uint8_t left, uint8_t width, uint
 void ssd1306_line(ssd1306_t *ssd, uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1, bool value);
 void ssd1306_hline(ssd1306_t *ssd, uint8_t x0, uint8_t x1, uint8_t y, bool value);
 void ssd1306_vline(ssd1306_t *ssd, uint8_t x, uint8_t y0, uint8_t y1, bool value);
+void ssd1306_draw_glyph(ssd1306_t *ssd, const font_t *font, uint8_t code, uint8_t x, uint8_t y);
 void ssd1306_draw_char(ssd1306_t *ssd, char c, uint8_t x, uint8_t y);
 void ssd1306_draw_string(ssd1306_t *ssd, const char *str, uint8_t x, uint8_t y);
+void ssd1306_draw_string_font(ssd1306_t *ssd, const font_t *font, const char *str, uint8_t x, uint8_t y);
 
 #endif
@@ -0,0 +1,108 @@
+#include "telemetry.h"
+#include "hardware/irq.h"
+#include "hardware/sync.h"
+
+#define RING_MASK (TELEMETRY_RING_SIZE - 1)
+
+// Anel de transmissão: o produtor (tarefa) avança head e a interrupção da
+// UART avança tail, ambos no mesmo núcleo.
+static uint8_t ring[TELEMETRY_RING_SIZE];
+static volatile uint16_t head = 0;
+static volatile uint16_t tail = 0;
+static uart_inst_t *telemetry_uart;
+static uint32_t dropped = 0;
+
+// Estado do codificador COBS escrevendo direto no anel.
+typedef struct
+{
+    uint16_t pos;      // Próximo byte
+    uint16_t code_pos; // Byte de código do bloco atual
+    uint8_t code;
+} cobs_state_t;
+
+static inline void cobs_put(cobs_state_t *cobs, uint8_t byte)
+{
+    if (byte != 0)
+    {
+        ring[cobs->pos] = byte;
+        cobs->pos = (cobs->pos + 1) & RING_MASK;
+        cobs->code++;
+    }
+    if (byte == 0 || cobs->code == 0xFF)
+    {
+        ring[cobs->code_pos] = cobs->code;
+        cobs->code_pos = cobs->pos;
+        cobs->pos = (cobs->pos + 1) & RING_MASK;
+        cobs->code = 1;
+    }
+}
+
+// Move bytes do anel para a FIFO da UART sem esperar; a interrupção de TX
+// fica habilitada enquanto houver bytes pendentes.
+static void telemetry_fill_fifo()
+{
+    uint16_t t = tail;
+
+    while (t != head && uart_is_writable(telemetry_uart))
+    {
+        uart_get_hw(telemetry_uart)->dr = ring[t];
+        t = (t + 1) & RING_MASK;
+    }
+    tail = t;
+    uart_set_irq_enables(telemetry_uart, false, t != head);
+}
+
+static void telemetry_irq_handler()
+{
+    telemetry_fill_fifo();
+}
+
+// Usa a UART (já configurada pelo stdio) exclusivamente para os quadros.
+void telemetry_init(uart_inst_t *uart)
+{
+    uint irq = uart == uart0 ? UART0_IRQ : UART1_IRQ;
+
+    telemetry_uart = uart;
+    head = tail = 0;
+    irq_set_exclusive_handler(irq, telemetry_irq_handler);
+    irq_set_enabled(irq, true);
+}
+
+// Enquadra o payload (CRC + COBS + delimitador) no anel sem bloquear.
+// Sem espaço para o quadro inteiro, ele é descartado e contabilizado.
+bool telemetry_send(const uint8_t *payload, uint16_t len)
+{
+    uint16_t encoded = len + TELEMETRY_CRC_SIZE;
+    uint16_t worst = encoded + encoded / 254 + 2; // Códigos COBS + delimitador
+    uint16_t used = (head - tail) & RING_MASK;
+
+    if (worst > TELEMETRY_RING_SIZE - 1 - used)
+    {
+        dropped++;
+        return false;
+    }
+
+    uint16_t crc = telemetry_crc16(payload, len);
+    cobs_state_t cobs = {(head + 1) & RING_MASK, head, 1};
+
+    for (uint16_t i = 0; i < len; ++i)
+        cobs_put(&cobs, payload[i]);
+    cobs_put(&cobs, (uint8_t)crc);
+    cobs_put(&cobs, (uint8_t)(crc >> 8));
+    ring[cobs.code_pos] = cobs.code;
+    ring[cobs.pos] = 0x00;
+
+    __dmb(); // Bytes no anel antes de publicar head
+    uint irq = telemetry_uart == uart0 ? UART0_IRQ : UART1_IRQ;
+    irq_set_enabled(irq, false);
+    head = (cobs.pos + 1) & RING_MASK;
+    telemetry_fill_fifo();
+    irq_set_enabled(irq, true);
+    return true;
+}
+
+// Quadros descartados por falta de espaço no anel.
+uint32_t telemetry_dropped()
+{
+    return dropped;
+}
@@ -0,0 +1,24 @@
+#ifndef TELEMETRY_H
+#define TELEMETRY_H
+
+#include "pico/stdlib.h"
+#include "hardware/uart.h"
+#include "telemetry_protocol.h"
+
+#define TELEMETRY_RING_BITS 11 // 2 KB para quadros aguardando a UART
+#define TELEMETRY_RING_SIZE (1u << TELEMETRY_RING_BITS)
+
+void telemetry_init(uart_inst_t *uart);
+bool telemetry_send(const uint8_t *payload, uint16_t len);
+uint32_t telemetry_dropped();
+
+// Inicia um payload com o cabeçalho comum; retorna o tamanho escrito.
+static inline uint16_t telemetry_header(uint8_t *payload, uint8_t type, uint32_t timestamp_ms)
+{
+    payload[0] = type;
+    payload[1] = TELEMETRY_VERSION;
+    telemetry_put_u32(&payload[2], timestamp_ms);
+    return TELEMETRY_HEADER_SIZE;
+}
+
+#endif // TELEMETRY_H
@@ -0,0 +1,65 @@
+#ifndef TELEMETRY_PROTOCOL_H
+#define TELEMETRY_PROTOCOL_H
+
+// Formato dos quadros de telemetria binária, compartilhado entre o firmware
+// e o decodificador do host (tools/telemetry_decode.c): apenas C padrão.
+//
+// Quadro na serial: COBS(payload || CRC-16 little-endian) seguido de 0x00.
+// Todos os campos do payload são little-endian.
+
+#include <stdint.h>
+#include <stddef.h>
+#include "crc16.h"
+
+#define TELEMETRY_VERSION 1
+
+// Payload comum: tipo (1), versão (1), instante em ms desde o boot (4)
+#define TELEMETRY_HEADER_SIZE 6
+
+// Leituras de todos os ambientes:
+//   cabeçalho, ambientes (1), flags (1), e por ambiente:
+//   temperatura (int16, centésimos), umidade (int16, centésimos), flags (1)
+#define TELEMETRY_FRAME_SNAPSHOT 1
+#define TELEMETRY_SNAPSHOT_ROOM_SIZE 5
+#define TELEMETRY_FLAG_FULL_RECORDING 0x01
+#define TELEMETRY_ROOM_CAM_ON 0x01
+
+// Estatísticas do sistema:
+//   cabeçalho, ocioso núcleo 0 e 1 (uint16, centésimos de porcento),
+//   render OLED (us), latência botão -> frame (us), bytes OLED enviados,
+//   frames da matriz enviados, quadros de telemetria descartados (uint32 cada)
+#define TELEMETRY_FRAME_STATS 2
+#define TELEMETRY_STATS_SIZE (TELEMETRY_HEADER_SIZE + 2 * 2 + 5 * 4)
+
+#define TELEMETRY_CRC_SIZE 2
+#define TELEMETRY_MAX_PAYLOAD 512
+
+// CRC do payload (CRC-16/CCITT-FALSE).
+static inline uint16_t telemetry_crc16(const uint8_t *data, size_t len)
+{
+    return crc16_update(CRC16_INIT, data, len);
+}
+
+static inline void telemetry_put_u16(uint8_t *p, uint16_t value)
+{
+    p[0] = (uint8_t)value;
+    p[1] = (uint8_t)(value >> 8);
+}
+
+static inline void telemetry_put_u32(uint8_t *p, uint32_t value)
+{
+    telemetry_put_u16(p, (uint16_t)value);
+    telemetry_put_u16(p + 2, (uint16_t)(value >> 16));
+}
+
+static inline uint16_t telemetry_get_u16(const uint8_t *p)
+{
+    return (uint16_t)(p[0] | (p[1] << 8));
+}
+
+static inline uint32_t telemetry_get_u32(const uint8_t *p)
+{
+    return telemetry_get_u16(p) | ((uint32_t)telemetry_get_u16(p + 2) << 16);
+}
+
+#endif // TELEMETRY_PROTOCOL_H
@@ -0,0 +1,82 @@
+#include <string.h>
+#include "widget.h"
+
+// Associa os campos (fornecidos pelo chamador) à tela; todos começam inválidos.
+void widget_screen_init(widget_screen_t *screen, widget_field_t *fields, uint8_t count)
+{
+    screen->fields = fields;
+    screen->count = count;
+    for (uint8_t i = 0; i < count; ++i)
+    {
+        widget_field_t *field = &fields[i];
+        if (field->font == NULL)
+            field->font = &font_small;
+        field->value_x = field->x + (field->label != NULL ? font_text_width(&font_small, field->label) : 0);
+        field->width = 0;
+    }
+    widget_invalidate(screen);
+}
+
+// Força o redesenho completo na próxima atualização (ex.: após limpar o
+// buffer do display para outra tela).
+void widget_invalidate(widget_screen_t *screen)
+{
+    for (uint8_t i = 0; i < screen->count; ++i)
+        screen->fields[i].valid = false;
+}
+
+// Redesenha apenas os campos cujo texto mudou: o novo valor é escrito por
+// cima do anterior e só a sobra do texto antigo é apagada. Durante a
+// atualização as primitivas do display não marcam regiões (dirty_manual):
+// a caixa de cada campo redesenhado (a união do valor novo com o antigo) é
+// a única região suja, então o envio seguinte transmite apenas as janelas
+// dos campos alterados. Retorna quantos campos mudaram.
+uint8_t widget_update(ssd1306_t *ssd, widget_screen_t *screen)
+{
+    char text[WIDGET_TEXT_MAX + 1];
+    uint8_t redrawn = 0;
+    bool dirty_manual = ssd->dirty_manual;
+
+    ssd->dirty_manual = true;
+
+    for (uint8_t i = 0; i < screen->count; ++i)
+    {
+        widget_field_t *field = &screen->fields[i];
+
+        if (field->valid && (field->value == NULL || memcmp(field->value, field->last_value, field->value_size) == 0))
+            continue;
+
+        if (!field->valid && field->label != NULL)
+        {
+            ssd1306_draw_string(ssd, field->label, field->x, field->y);
+            ssd1306_mark_dirty_rect(ssd, field->x, field->y, field->value_x - field->x, font_small.pages * 8);
+        }
+
+        if (field->value != NULL)
+        {
+            memcpy(field->last_value, field->value, field->value_size);
+            text[WIDGET_TEXT_MAX] = '\0';
+            field->format(text, field->value);
+
+            if (!field->valid || strcmp(text, field->text) != 0)
+            {
+                uint16_t text_width = font_text_width(field->font, text);
+                uint8_t width = text_width < ssd->width - field->value_x ? text_width : ssd->width - field->value_x;
+                uint8_t height = field->font->pages * 8;
+                ssd1306_draw_string_font(ssd, field->font, text, field->value_x, field->y);
+                if (width < field->width)
+                    ssd1306_rect(ssd, field->y, field->value_x + width, field->width - width, height, false, true);
+                ssd1306_mark_dirty_rect(ssd, field->value_x, field->y, width > field->width ? width : field->width,
+                                        height);
+                strcpy(field->text, text);
+                field->width = width;
+                redrawn++;
+            }
+        }
+
+        field->valid = true;
+    }
+
+    ssd->dirty_manual = dirty_manual;
+    return redrawn;
+}
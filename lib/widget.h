@@ -0,0 +1,55 @@
+#ifndef WIDGET_H
+#define WIDGET_H
+
+#include "pico/stdlib.h"
+#include "ssd1306.h"
+
+#define WIDGET_TEXT_MAX (WIDTH / 8) // Caracteres por campo (uma linha do display)
+#define WIDGET_VALUE_MAX 16         // Bytes do dado ligado a um campo
+
+// Formata o dado ligado ao campo em text (até WIDGET_TEXT_MAX caracteres).
+typedef void (*widget_format_t)(char *text, const void *value);
+
+// Campo de texto em modo retido: rótulo fixo seguido do valor formatado do
+// dado ligado. Guarda o último dado e o último texto desenhado, para
+// reformatar apenas quando o dado muda e redesenhar apenas quando o texto muda.
+typedef struct
+{
+    uint8_t x, y;
+    const char *label;       // Texto fixo antes do valor (NULL: nenhum)
+    const void *value;       // Dado ligado (NULL: apenas o rótulo)
+    uint8_t value_size;
+    widget_format_t format;
+    const font_t *font;      // Fonte do valor (NULL: font_small); o rótulo usa sempre font_small
+    // Estado retido
+    uint8_t value_x;         // Coluna onde começa o valor
+    uint8_t width;           // Largura em pixels do último valor desenhado
+    bool valid;              // false: desenhar tudo na próxima atualização
+    uint8_t last_value[WIDGET_VALUE_MAX];
+    char text[WIDGET_TEXT_MAX + 1];
+} widget_field_t;
+
+// Rótulo fixo: desenhado apenas quando a tela é invalidada.
+#define WIDGET_LABEL(px, py, text) { .x = (px), .y = (py), .label = (text) }
+
+// Campo ligado a um objeto; o array de tamanho negativo rejeita, em tempo de
+// compilação, objetos maiores que WIDGET_VALUE_MAX.
+#define WIDGET_FIELD_FONT(px, py, text, source, formatter, value_font)                     \
+    {                                                                                      \
+        .x = (px), .y = (py), .label = (text), .value = &(source),                         \
+        .value_size = sizeof(source) + 0 * sizeof(char[sizeof(source) <= WIDGET_VALUE_MAX ? 1 : -1]), \
+        .format = (formatter), .font = (value_font)                                        \
+    }
+#define WIDGET_FIELD(px, py, text, source, formatter) WIDGET_FIELD_FONT(px, py, text, source, formatter, NULL)
+
+typedef struct
+{
+    widget_field_t *fields;
+    uint8_t count;
+} widget_screen_t;
+
+void widget_screen_init(widget_screen_t *screen, widget_field_t *fields, uint8_t count);
+void widget_invalidate(widget_screen_t *screen);
+uint8_t widget_update(ssd1306_t *ssd, widget_screen_t *screen);
+
+#endif // WIDGET_H
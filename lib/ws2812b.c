@@ -1,10 +1,87 @@
+#include <string.h>
 #include "ws2812b.h"
 #include "led_matrix.pio.h"
+#include "hardware/dma.h"
+#include "hardware/irq.h"
+#include "hardware/sync.h"
 
 ws2812b_LED_t led_matrix[LED_MATRIX_COUNT];
 PIO led_matrix_pio;
 uint sm;
 
+// Correção gama (2.8) pré-calculada: cor perceptual -> intensidade do LED.
+static const uint8_t gamma_lut[256] = {
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   1,   1,   1,
+      1,   1,   1,   1,   1,   1,   1,   1,   1,   2,   2,   2,   2,   2,   2,   2,
+      2,   3,   3,   3,   3,   3,   3,   3,   4,   4,   4,   4,   4,   5,   5,   5,
+      5,   6,   6,   6,   6,   7,   7,   7,   7,   8,   8,   8,   9,   9,   9,  10,
+     10,  10,  11,  11,  11,  12,  12,  13,  13,  13,  14,  14,  15,  15,  16,  16,
+     17,  17,  18,  18,  19,  19,  20,  20,  21,  21,  22,  22,  23,  24,  24,  25,
+     25,  26,  27,  27,  28,  29,  29,  30,  31,  32,  32,  33,  34,  35,  35,  36,
+     37,  38,  39,  39,  40,  41,  42,  43,  44,  45,  46,  47,  48,  49,  50,  50,
+     51,  52,  54,  55,  56,  57,  58,  59,  60,  61,  62,  63,  64,  66,  67,  68,
+     69,  70,  72,  73,  74,  75,  77,  78,  79,  81,  82,  83,  85,  86,  87,  89,
+     90,  92,  93,  95,  96,  98,  99, 101, 102, 104, 105, 107, 109, 110, 112, 114,
+    115, 117, 119, 120, 122, 124, 126, 127, 129, 131, 133, 135, 137, 138, 140, 142,
+    144, 146, 148, 150, 152, 154, 156, 158, 160, 162, 164, 167, 169, 171, 173, 175,
+    177, 180, 182, 184, 186, 189, 191, 193, 196, 198, 200, 203, 205, 208, 210, 213,
+    215, 218, 220, 223, 225, 228, 231, 233, 236, 239, 241, 244, 247, 249, 252, 255
+};
+
+// Gama combinada ao brilho global; recalculada apenas quando o brilho muda.
+static uint8_t color_lut[256];
+static uint8_t brightness = WS2812B_DEFAULT_BRIGHTNESS;
+
+// Cores perceptuais (R, G, B) de cada LED, antes da correção.
+static uint8_t led_colors[LED_MATRIX_COUNT][3];
+
+// Transmissão via DMA: dois frames, um em envio e outro aguardando a vez.
+static ws2812b_LED_t tx_frames[2][LED_MATRIX_COUNT];
+static uint8_t tx_active = 0;           // Frame em envio
+static volatile int8_t tx_pending = -1; // Frame aguardando o fim do envio atual
+static volatile bool tx_busy = false;   // DMA ou latch em andamento
+static int dma_chan;
+static spin_lock_t *tx_lock;
+
+// Detecção de mudanças: geração do buffer e geração do último frame enviado.
+static uint32_t led_matrix_generation = 1;
+static uint32_t tx_generation = 0;
+static int8_t tx_last = -1; // Último frame entregue ao DMA (-1: nenhum ainda)
+static ws2812b_stats_t stats;
+
+// Inicia o envio de um frame pelo DMA. Chamar com tx_lock adquirido.
+static void ws2812b_start_frame(uint8_t frame)
+{
+    tx_active = frame;
+    tx_busy = true;
+    dma_channel_transfer_from_buffer_now(dma_chan, tx_frames[frame], LED_MATRIX_COUNT);
+}
+
+// Fim do tempo de RESET: os LEDs travaram o frame. Envia o próximo, se houver.
+static int64_t ws2812b_latch_alarm_callback(alarm_id_t id, void *user_data)
+{
+    uint32_t irq = spin_lock_blocking(tx_lock);
+    tx_busy = false;
+    if (tx_pending >= 0)
+    {
+        ws2812b_start_frame(tx_pending);
+        tx_pending = -1;
+    }
+    spin_unlock(tx_lock, irq);
+    return 0;
+}
+
+// Fim do DMA: agenda o latch em vez de esperar com sleep_us.
+static void ws2812b_dma_irq_handler(void)
+{
+    if (dma_channel_get_irq1_status(dma_chan))
+    {
+        dma_channel_acknowledge_irq1(dma_chan);
+        add_alarm_in_us(WS2812B_LATCH_US, ws2812b_latch_alarm_callback, NULL, true);
+    }
+}
+
 // Inicializa a máquina PIO para controle da matriz de LEDs.
 void ws2812b_init(uint pin)
 {
@@ -25,20 +102,64 @@ void ws2812b_init(uint pin)
     led_matrix_program_init(led_matrix_pio, sm, offset, pin, 800000.f);
 
     // Limpa buffer de pixels.
+    ws2812b_set_brightness(brightness);
+    for (uint i = 0; i < LED_MATRIX_COUNT; ++i)
+        ws2812b_set_led(i, 0, 0, 0);
+
+    // Canal DMA que alimenta o FIFO da máquina PIO, uma palavra por LED.
+    tx_lock = spin_lock_instance(spin_lock_claim_unused(true));
+    dma_chan = dma_claim_unused_channel(true);
+    dma_channel_config c = dma_channel_get_default_config(dma_chan);
+    channel_config_set_transfer_data_size(&c, DMA_SIZE_32);
+    channel_config_set_read_increment(&c, true);
+    channel_config_set_write_increment(&c, false);
+    channel_config_set_dreq(&c, pio_get_dreq(led_matrix_pio, sm, true));
+    dma_channel_configure(dma_chan, &c, &led_matrix_pio->txf[sm], tx_frames[0], LED_MATRIX_COUNT, false);
+
+    // DMA_IRQ_1, a mesma linha do display: os dois são servidos pelo núcleo
+    // que os inicializa (a linha DMA_IRQ_0 fica com a amostragem do ADC).
+    dma_channel_set_irq1_enabled(dma_chan, true);
+    irq_add_shared_handler(DMA_IRQ_1, ws2812b_dma_irq_handler, PICO_SHARED_IRQ_HANDLER_DEFAULT_ORDER_PRIORITY);
+    irq_set_enabled(DMA_IRQ_1, true);
+}
+
+// Empacota uma cor perceptual na palavra GRB já corrigida (gama + brilho).
+static inline ws2812b_LED_t ws2812b_pack(uint8_t r, uint8_t g, uint8_t b)
+{
+    return ((uint32_t)color_lut[g] << 24) | ((uint32_t)color_lut[r] << 16) | ((uint32_t)color_lut[b] << 8);
+}
+
+// Define o brilho global (0-255) e reempacota o buffer com a nova escala.
+void ws2812b_set_brightness(uint8_t value)
+{
+    brightness = value;
+    for (uint i = 0; i < 256; ++i)
+        color_lut[i] = (gamma_lut[i] * (brightness + 1)) >> 8;
+
     for (uint i = 0; i < LED_MATRIX_COUNT; ++i)
     {
-        led_matrix[i].R = 0;
-        led_matrix[i].G = 0;
-        led_matrix[i].B = 0;
+        ws2812b_LED_t packed = ws2812b_pack(led_colors[i][0], led_colors[i][1], led_colors[i][2]);
+        if (led_matrix[i] != packed)
+        {
+            led_matrix[i] = packed;
+            led_matrix_generation++;
+        }
     }
 }
 
-// Atribui uma cor RGB a um LED.
+// Atribui uma cor RGB perceptual (0-255) a um LED.
 void ws2812b_set_led(const uint index, const uint8_t r, const uint8_t g, const uint8_t b)
 {
-    led_matrix[index].R = r;
-    led_matrix[index].G = g;
-    led_matrix[index].B = b;
+    led_colors[index][0] = r;
+    led_colors[index][1] = g;
+    led_colors[index][2] = b;
+
+    ws2812b_LED_t value = ws2812b_pack(r, g, b);
+    if (led_matrix[index] != value)
+    {
+        led_matrix[index] = value;
+        led_matrix_generation++;
+    }
 }
 
 // Limpa o buffer de pixels.
@@ -48,41 +169,72 @@ void ws2812b_clear()
         ws2812b_set_led(i, 0, 0, 0);
 }
 
-// Escreve os dados do buffer nos LEDs.
+// Escreve os dados do buffer nos LEDs. Retorna imediatamente: o frame é
+// copiado e enviado pelo DMA; se outro frame estiver em envio, este passa a
+// ser o próximo (substituindo um frame que ainda aguardava). Não faz nada se
+// o buffer não mudou desde o último frame entregue.
 void ws2812b_write()
 {
-    // Escreve cada dado de 8-bits dos pixels em sequência no buffer da máquina PIO.
-    for (uint i = 0; i < LED_MATRIX_COUNT; ++i)
+    stats.frames_requested++;
+
+    // Nenhum ws2812b_set_led alterou o buffer
+    if (led_matrix_generation == tx_generation)
+        return;
+
+    uint32_t irq = spin_lock_blocking(tx_lock);
+
+    // O buffer mudou, mas voltou ao conteúdo do último frame (ex.: clear + redesenho)
+    if (tx_last >= 0 && memcmp(tx_frames[tx_last], led_matrix, sizeof(led_matrix)) == 0)
     {
-        pio_sm_put_blocking(led_matrix_pio, sm, led_matrix[i].G);
-        pio_sm_put_blocking(led_matrix_pio, sm, led_matrix[i].R);
-        pio_sm_put_blocking(led_matrix_pio, sm, led_matrix[i].B);
+        tx_generation = led_matrix_generation;
+        spin_unlock(tx_lock, irq);
+        return;
     }
-    sleep_us(100); // Espera 100us, sinal de RESET do datasheet.
+
+    uint8_t frame = tx_busy ? tx_active ^ 1 : tx_active;
+    memcpy(tx_frames[frame], led_matrix, sizeof(led_matrix));
+    tx_last = frame;
+    tx_generation = led_matrix_generation;
+    stats.frames_sent++;
+    if (tx_busy)
+        tx_pending = frame;
+    else
+        ws2812b_start_frame(frame);
+    spin_unlock(tx_lock, irq);
 }
 
-// Desenha um número na matriz de LEDs.
-void ws2812b_draw_number(uint8_t number_index)
+// Retorna os contadores de frames pedidos e realmente enviados.
+ws2812b_stats_t ws2812b_get_stats()
 {
-    uint8_t r, g, b;
+    return stats;
+}
 
-    // Atribui a cor do número atual.
-    r = led_matrix_number_colors[number_index][0];
-    g = led_matrix_number_colors[number_index][1];
-    b = led_matrix_number_colors[number_index][2];
+// Indica se o último frame escrito já foi enviado e travado pelos LEDs.
+bool ws2812b_is_latched()
+{
+    return !tx_busy && tx_pending < 0;
+}
 
-    // Limpa a matriz de LEDs.
-    ws2812b_clear();
-    ws2812b_write();
+// Aguarda o último frame escrito ser travado pelos LEDs.
+void ws2812b_wait_latched()
+{
+    while (!ws2812b_is_latched())
+        tight_loop_contents();
+}
 
-    // Desenha o número na matriz de LEDs.
-    printf("Desenhando número %d\n", number_index);
-    for (int i = 0; i < LED_MATRIX_COUNT; i++)
+// Desenha um número na matriz de LEDs.
+void ws2812b_draw_number(uint8_t number_index)
+{
+    const uint8_t *color = led_matrix_number_colors[number_index];
+    led_matrix_glyph_t glyph = led_matrix_glyph('0' + number_index);
+
+    // Monta o frame completo antes de um único envio.
+    for (uint i = 0; i < LED_MATRIX_COUNT; i++)
     {
-        if (led_matrix_numbers[number_index][i] != 0)
-        {
-            ws2812b_set_led(i, r, g, b);
-        }
+        if (glyph & (1u << i))
+            ws2812b_set_led(led_matrix_index[i], color[0], color[1], color[2]);
+        else
+            ws2812b_set_led(led_matrix_index[i], 0, 0, 0);
     }
 
     // Atualiza a matriz de LEDs.
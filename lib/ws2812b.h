@@ -5,24 +5,37 @@
 #include <stdio.h>
 #include "hardware/pio.h"
 #include "pico/stdlib.h"
-#include "led_matrix_numbers.h"
+#include "led_matrix_glyphs.h"
+
+// Tempo até o último bit sair do FIFO da PIO (8 palavras + OSR, 30us cada)
+// somado aos 100us do sinal de RESET do datasheet.
+#define WS2812B_LATCH_US (9 * 30 + 100)
+
+// Brilho global inicial (0-255), aplicado após a correção gama.
+#define WS2812B_DEFAULT_BRIGHTNESS 32
 
 // Tipos de dados.
-struct pixel_t
+typedef uint32_t ws2812b_LED_t; // Pixel empacotado em uma palavra GRB (bits 31..8), pronto para a PIO.
+
+// Contadores de frames: pedidos em ws2812b_write e realmente enviados.
+typedef struct
 {
-    uint8_t G, R, B; // Três valores de 8-bits compõem um pixel.
-};
-typedef struct pixel_t pixel_t;
-typedef pixel_t ws2812b_LED_t; // Mudança de nome de "struct pixel_t" para "ws2812bLED_t" por clareza.
+    uint32_t frames_requested;
+    uint32_t frames_sent;
+} ws2812b_stats_t;
 
-extern ws2812b_LED_t led_matrix[LED_MATRIX_COUNT]; // Declaração do buffer de pixels que formam a matriz.
+extern ws2812b_LED_t led_matrix[LED_MATRIX_COUNT]; // Buffer de pixels da matriz; altere apenas via ws2812b_set_led.
 extern PIO led_matrix_pio;                     // Ponteiro para a máquina PIO.
 extern uint sm;                        // Número da máquina state machine.
 
 void ws2812b_init(uint pin);
 void ws2812b_set_led(const uint index, const uint8_t r, const uint8_t g, const uint8_t b);
+void ws2812b_set_brightness(uint8_t value);
 void ws2812b_clear();
 void ws2812b_write();
+bool ws2812b_is_latched();
+void ws2812b_wait_latched();
+ws2812b_stats_t ws2812b_get_stats();
 void ws2812b_draw_number(uint8_t index);
 
 #endif // WS2812B_H
@@ -1,5 +1,6 @@
 #include <stdio.h>
 #include <string.h>
+#include <assert.h>
 #include "pico/stdlib.h"
 #include "hardware/i2c.h"
 #include "hardware/pio.h"
@@ -7,16 +8,32 @@
 #include "hardware/clocks.h"
 #include "hardware/adc.h"
 #include "hardware/pwm.h"
+#include "hardware/sync.h"
+#include "pico/multicore.h"
+#include "pico/stdio_uart.h"
 
 #include "lib/ssd1306.h"
-#include "lib/font.h"
 #include "lib/ws2812b.h"
+#include "lib/adc_sampler.h"
+#include "lib/fixed_point.h"
+#include "lib/spsc_queue.h"
+#include "lib/scheduler.h"
+#include "lib/alarm_rules.h"
+#include "lib/room_store.h"
+#include "lib/history.h"
+#include "lib/chart.h"
+#include "lib/telemetry.h"
+#include "lib/flash_log.h"
+#include "lib/flash_log_pico.h"
+#include "lib/profile.h"
+#include "lib/widget.h"
+#include "lib/led_matrix_anim.h"
+#include "lib/app_config.h"
+#include "lib/buzzer.h"
 
 #define I2C_PORT i2c1
 #define I2C_SDA 14
 #define I2C_SCL 15
-#define I2C_ADDRESS 0x3C
-#define LED_MATRIX_PIN 7
 #define GREEN_LED_PIN 11
 #define BLUE_LED_PIN 12
 #define RED_LED_PIN 13
@@ -24,26 +41,82 @@
 #define BTN_B_PIN 6
 #define BUZZER_A_PIN 21
 #define BUZZER_B_PIN 10
+#define BUZZER_TICK_SLICE 0 // Slice de PWM sem pino que marca o tempo dos padrões do buzzer
 #define VRX_PIN 27
 #define VRY_PIN 26
 #define SW_PIN 22
-#define ADC_MAX_VALUE 4096
-#define MAX_TEMP 62
-#define NUM_ROOM 3
-#define ALARM_DURATION 5000
-#define ALARM_DELAY 5000 // 3600000
+#define ALARM_ESCALATE_MS 2500 // Buzzer ativo há mais tempo passa do padrão de aviso ao urgente
+#define HISTORY_BUDGET_BYTES (96 * 1024) // Limite de RAM para o histórico
+#define SNAPSHOT_QUEUE_SIZE 4 // Cópias em trânsito para o núcleo 1
+#define CHART_QUEUE_SIZE 2 // Gráficos em trânsito para o núcleo 1
+#define SW_LONG_PRESS_MS 600 // Pressão longa no joystick troca a tela
+#define TELEMETRY_UART uart0 // UART do stdio (GPIO 0/1)
+// 1: telemetria em texto (printf) para depuração; 0: quadros binários na UART
+#ifndef TELEMETRY_TEXT
+#define TELEMETRY_TEXT 0
+#endif
+// Períodos das tarefas, em ms (0: apenas por evento)
+#define SAMPLE_PERIOD_MS 100
+#define PUBLISH_PERIOD_MS 250
+#define TELEMETRY_PERIOD_MS 1000
+#define OLED_PERIOD_MS 1000
+#define LED_PERIOD_MS 500
+#define MATRIX_FRAME_MS 25 // 40 frames/s: uma coluna de rolagem a cada LED_ANIM_FADE_STEPS frames
+#define CHART_PERIOD_MS 1000
+#define LOG_READINGS_PERIOD_MS 300000 // Leituras gravadas na flash a cada 5 min
+#define LOG_FLUSH_MS 5000 // Página parcial do log gravada na flash a cada 5 s
+#define CONSOLE_PERIOD_MS 100 // Leitura dos comandos da serial
+
+static_assert(NUM_ROOM <= ROOM_STORE_CAPACITY, "NUM_ROOM excede a capacidade do armazenamento");
+static_assert(NUM_ROOM * ALARM_METRIC_COUNT * sizeof(history_series_t) <= HISTORY_BUDGET_BYTES,
+              "Histórico excede HISTORY_BUDGET_BYTES: reduza HISTORY_*_LEN ou NUM_ROOM");
+
+// Paginação e estado da câmera: cada grupo é ligado a um campo da tela de texto
+typedef struct {
+    uint8_t index; // Posição do ambiente, para a paginação no display
+    uint8_t count;
+} display_page_t;
 
-typedef struct room
-{
-    char name[10];
-    float temperature;
-    float humidity;
-    bool cam_on;
-} room_t;
+typedef struct {
+    bool on;
+    bool full_recording;
+} display_cam_t;
 
+// Cópia dos dados do ambiente selecionado, enviada ao núcleo de renderização
 typedef struct {
-    int buzzer_id;
-} buzzer_data_t;
+    char name[ROOM_NAME_MAX];
+    display_page_t page;
+    centi_t temperature;
+    centi_t humidity;
+    display_cam_t cam;
+    uint8_t view;      // Tela exibida (display_view_t)
+    uint32_t input_us; // Instante do último botão pressionado
+} display_snapshot_t;
+
+// Telas do display: texto ou gráfico de uma camada do histórico
+typedef enum { VIEW_TEXT, VIEW_CHART_RAW, VIEW_CHART_MINUTE, VIEW_CHART_HOUR, NUM_VIEWS } display_view_t;
+
+// Gráficos do ambiente selecionado, já reduzidos a uma coluna por pixel
+typedef struct {
+    uint8_t room;
+    uint8_t view;
+    chart_series_t temperature;
+    chart_series_t humidity;
+} chart_frame_t;
+
+enum { BUZZER_A, BUZZER_B, NUM_BUZZERS };
+enum { URGENCY_WARNING, URGENCY_URGENT, NUM_URGENCY }; // Níveis dos padrões do buzzer
+
+// Registros do log em flash; todos começam com o instante (ms desde o boot)
+enum { LOG_BOOT = 1, LOG_READINGS, LOG_ALARM, LOG_FULL_RECORDING };
+#define LOG_ROOMS_PER_RECORD 32 // Leituras: 1º ambiente, quantidade e pares (temperatura, umidade)
+
+// Índices das tarefas nas tabelas de cada núcleo
+enum { TASK_SAMPLE, TASK_ALARM, TASK_HISTORY, TASK_PUBLISH, TASK_CHART, TASK_LOG, TASK_LOG_FLUSH, TASK_TELEMETRY, TASK_CONSOLE };
+enum { TASK_OLED, TASK_LED, TASK_MATRIX };
+
+// Estágios medidos pelo perfil (lib/profile.h); cada um é medido por um só núcleo
+enum { PROF_SAMPLE, PROF_ALARM, PROF_RENDER, PROF_OLED_SEND, PROF_LED_WRITE };
 
 void init_led(uint8_t led_pin);
 void init_btn(uint8_t btn_pin);
@@ -52,122 +125,651 @@ void init_btns();
 void init_i2c();
 void init_display(ssd1306_t *ssd);
 void init_joystick();
-void pwm_init_buzzer(uint pin);
-void play_tone(uint pin, uint frequency);
 void read_joystick_xy_values(uint16_t *x_value, uint16_t *y_value);
-void process_joystick_xy_values(uint16_t x_value_raw, uint16_t y_value_raw, float *x_value, float *y_value);
-void draw_temperature_level(float temperature);
-void blink_humidity_level(float humidity);
+void process_joystick_xy_values(uint16_t x_value_raw, uint16_t y_value_raw, centi_t *x_value, centi_t *y_value);
+void scroll_temperature(centi_t temperature);
+void blink_humidity_level(centi_t humidity);
 void gpio_irq_handler(uint gpio, uint32_t events);
-int64_t turn_off_buzzer_alarm_callback(alarm_id_t id, void *user_data);
-int64_t buzzer_reset_state_alarm_callback(alarm_id_t id, void *user_data);
-
-room_t rooms[NUM_ROOM];
+void core1_main();
+void sample_task();
+void alarm_task();
+void history_task();
+void log_task();
+void log_flush_task();
+void init_flash_log();
+void replay_log(void *ctx, uint8_t type, const uint8_t *data, uint8_t len, uint32_t seq);
+void log_append(uint8_t type, const void *data, uint8_t len);
+void publish_task();
+void chart_task();
+void telemetry_task();
+void console_task();
+void measure_idle(uint16_t idle[2]);
+void print_telemetry(const uint16_t idle[2]);
+void send_telemetry(const uint16_t idle[2]);
+void receive_snapshot();
+void oled_task();
+void draw_text_view();
+void format_name(char *text, const void *value);
+void format_page(char *text, const void *value);
+void format_temperature(char *text, const void *value);
+void format_humidity(char *text, const void *value);
+void format_cam(char *text, const void *value);
+void draw_chart_view();
+void led_task();
+void matrix_task();
+void init_rooms();
+void init_alarm_rules();
+void alarm_buzzer_start(uint32_t buzzer);
+void alarm_buzzer_stop(uint32_t buzzer);
+int64_t alarm_buzzer_escalate(alarm_id_t id, void *user_data);
+void camera_start(uint32_t room);
+void camera_stop(uint32_t room);
+
+room_store_t rooms;
+// Vetores contíguos de cada métrica, indexados pelo ambiente
+static const centi_t *const room_metrics[ALARM_METRIC_COUNT] = {
+    [ALARM_METRIC_TEMPERATURE] = rooms.temperature,
+    [ALARM_METRIC_HUMIDITY] = rooms.humidity,
+};
 static volatile int room_id = 0;
+// Padrões dos alarmes, com divisor e wrap de cada nota calculados na compilação:
+// frio extremo (buzzer A) em bipes, calor extremo (buzzer B) em sirene. Cada
+// um começa no aviso e, após ALARM_ESCALATE_MS, passa ao urgente (mais rápido)
+static const buzzer_step_t cold_warning_steps[] = {
+    BUZZER_NOTE(300, 150), BUZZER_PAUSE(100), BUZZER_NOTE(300, 150), BUZZER_PAUSE(600),
+};
+static const buzzer_step_t cold_urgent_steps[] = {
+    BUZZER_NOTE(300, 100), BUZZER_PAUSE(60), BUZZER_NOTE(300, 100), BUZZER_PAUSE(60),
+    BUZZER_NOTE(300, 100), BUZZER_PAUSE(200),
+};
+static const buzzer_step_t hot_warning_steps[] = {
+    BUZZER_NOTE(415, 250), BUZZER_NOTE(554, 250),
+};
+static const buzzer_step_t hot_urgent_steps[] = {
+    BUZZER_NOTE(554, 120), BUZZER_NOTE(740, 120),
+};
+static const buzzer_pattern_t alarm_patterns[NUM_BUZZERS][NUM_URGENCY] = {
+    [BUZZER_A] = {BUZZER_PATTERN(cold_warning_steps, true), BUZZER_PATTERN(cold_urgent_steps, true)},
+    [BUZZER_B] = {BUZZER_PATTERN(hot_warning_steps, true), BUZZER_PATTERN(hot_urgent_steps, true)},
+};
+static buzzer_t buzzers[NUM_BUZZERS];
+static alarm_id_t buzzer_escalation[NUM_BUZZERS]; // Temporizador da passagem ao urgente (0: nenhum)
 static volatile int64_t last_valid_press_time_btn_a = 0;
 static volatile int64_t last_valid_press_time_btn_b = 0;
 static volatile int64_t last_valid_press_time_sw = 0;
+static volatile int64_t sw_press_time = -1; // Início da pressão atual do joystick
 static volatile bool full_recording = false;
-static volatile bool buzzer_a_playing = false;
-static volatile bool buzzer_b_playing = false;
-static buzzer_data_t buzzer_a_data = {1};
-static buzzer_data_t buzzer_b_data = {2};
+static volatile uint8_t view = VIEW_TEXT;
+static ssd1306_buffers_t display_buffers; // Buffers do display, sem heap
+static spsc_queue_t snapshot_queue; // Núcleo 0 -> núcleo 1
+static display_snapshot_t snapshot_queue_buffer[SNAPSHOT_QUEUE_SIZE];
+static display_snapshot_t current_snapshot; // Última cópia recebida pelo núcleo 1
+static spsc_queue_t chart_queue; // Núcleo 0 -> núcleo 1, apenas nas telas de gráfico
+static chart_frame_t chart_queue_buffer[CHART_QUEUE_SIZE];
+static chart_frame_t current_chart;
+// Tela de texto em modo retido: cada campo é reformatado e redesenhado
+// apenas quando o dado ligado a ele muda
+static widget_field_t text_fields[] = {
+    WIDGET_FIELD(30, 0, NULL, current_snapshot.name, format_name),
+    WIDGET_FIELD(30, 10, NULL, current_snapshot.page, format_page),
+    WIDGET_FIELD_FONT(30, 20, NULL, current_snapshot.temperature, format_temperature, &font_large),
+    WIDGET_FIELD(30, 22 + FONT_LARGE_HEIGHT, "Hum:", current_snapshot.humidity, format_humidity),
+    WIDGET_FIELD(30, 56, "Cam:", current_snapshot.cam, format_cam),
+};
+static widget_screen_t text_screen;
+static led_anim_t matrix_anim; // Temperatura rolando na matriz de LEDs (núcleo 1)
+static ssd1306_t ssd; // Estrutura do display (usada pelo núcleo 1)
+static uint16_t vrx_values_raw[NUM_ROOM];
+static uint16_t vry_values_raw[NUM_ROOM];
+static volatile uint32_t input_event_us = 0;   // Instante do último botão válido
+static volatile uint32_t input_latency_us = 0; // Botão -> frame entregue ao DMA
+static volatile uint32_t render_us = 0;        // Tempo do último desenho do OLED
+
+static task_t core0_tasks[] = {
+    [TASK_SAMPLE] = TASK("amostragem", sample_task, SAMPLE_PERIOD_MS),
+    [TASK_ALARM] = TASK("alarmes", alarm_task, 0),
+    [TASK_HISTORY] = TASK("historico", history_task, HISTORY_SAMPLE_PERIOD_MS),
+    [TASK_PUBLISH] = TASK("publicacao", publish_task, PUBLISH_PERIOD_MS),
+    [TASK_CHART] = TASK("grafico", chart_task, CHART_PERIOD_MS),
+    [TASK_LOG] = TASK("log", log_task, LOG_READINGS_PERIOD_MS),
+    [TASK_LOG_FLUSH] = TASK("log_flush", log_flush_task, LOG_FLUSH_MS),
+    [TASK_TELEMETRY] = TASK("telemetria", telemetry_task, TELEMETRY_PERIOD_MS),
+    [TASK_CONSOLE] = TASK("console", console_task, CONSOLE_PERIOD_MS),
+};
+static task_t core1_tasks[] = {
+    [TASK_OLED] = TASK("oled", oled_task, OLED_PERIOD_MS),
+    [TASK_LED] = TASK("leds", led_task, LED_PERIOD_MS),
+    [TASK_MATRIX] = TASK("matriz", matrix_task, MATRIX_FRAME_MS),
+};
+static scheduler_t core0_scheduler;
+static scheduler_t core1_scheduler;
+static profile_stage_t profile_stages[] = {
+    [PROF_SAMPLE] = PROFILE_STAGE("joystick"),     // Núcleo 0
+    [PROF_ALARM] = PROFILE_STAGE("alarmes"),       // Núcleo 0
+    [PROF_RENDER] = PROFILE_STAGE("desenho"),      // Núcleo 1
+    [PROF_OLED_SEND] = PROFILE_STAGE("oled_envio"), // Núcleo 1
+    [PROF_LED_WRITE] = PROFILE_STAGE("ws2812b"),   // Núcleo 1
+};
+static alarm_rule_t alarm_rules[NUM_RULES];
+static alarm_rule_state_t alarm_rule_states[NUM_RULES];
+static alarm_action_t alarm_actions[NUM_ACTIONS];
+static uint8_t alarm_action_refs[NUM_ACTIONS];
+static history_series_t history_series[ALARM_METRIC_COUNT * NUM_ROOM];
+static history_t history;
+static flash_log_dev_t flash_log_dev;
+static flash_log_t flash_log;
+static uint32_t logged_fired[NUM_RULES]; // Disparos de cada regra já registrados no log
+static bool logged_full_recording = false;
+static uint32_t log_readings_ms = 0;
 
 int main()
 {
-    // Inicializa o display OLED
-    ssd1306_t ssd; // Inicializa a estrutura do display
-    uint16_t vrx_value_raw;
-    uint16_t vry_value_raw;
-    char temperature_text[20];
-    char humidity_text[20];
-    char cam_text[20];
-
     stdio_init_all();
+    profile_init(profile_stages, count_of(profile_stages));
 
     init_leds();
     init_btns();
     init_i2c();
-    init_display(&ssd);
-    ws2812b_init(LED_MATRIX_PIN); // Inicializa a matriz de LEDs
     adc_init();
     init_joystick();
-    pwm_init_buzzer(10);
-    pwm_init_buzzer(21);
-
-    strcpy(rooms[0].name, "Sala");
-    strcpy(rooms[1].name, "Quarto");
-    strcpy(rooms[2].name, "Cozinha");
+    buzzer_clock_init(BUZZER_TICK_SLICE);
+    buzzer_init(&buzzers[BUZZER_A], BUZZER_A_PIN);
+    buzzer_init(&buzzers[BUZZER_B], BUZZER_B_PIN);
+
+    init_rooms();
+    init_alarm_rules();
+    history_init(&history, history_series, NUM_ROOM, ALARM_METRIC_COUNT);
+    printf("Historico: %lu bytes (limite %lu), %u brutas a cada %u ms, %u minutos, %u horas\n",
+           (unsigned long)history_bytes(&history), (unsigned long)HISTORY_BUDGET_BYTES, HISTORY_RAW_LEN,
+           HISTORY_SAMPLE_PERIOD_MS, HISTORY_MINUTE_LEN, HISTORY_HOUR_LEN);
+    init_flash_log();
+
+    // Núcleo 1: display OLED, matriz de LEDs e LED RGB, alimentados pela fila
+    spsc_queue_init(&snapshot_queue, snapshot_queue_buffer, sizeof(display_snapshot_t), SNAPSHOT_QUEUE_SIZE);
+    spsc_queue_init(&chart_queue, chart_queue_buffer, sizeof(chart_frame_t), CHART_QUEUE_SIZE);
+    multicore_launch_core1(core1_main);
 
     gpio_set_irq_enabled_with_callback(BTN_A_PIN, GPIO_IRQ_EDGE_FALL, true, &gpio_irq_handler);
     gpio_set_irq_enabled(BTN_B_PIN, GPIO_IRQ_EDGE_FALL, true);
-    gpio_set_irq_enabled(SW_PIN, GPIO_IRQ_EDGE_FALL, true);
-
-    while (true)
-    {
-        // Pega os dados de temperatura e umidade de todos os sensores
-        for (int i=0; i < NUM_ROOM; i++) {
-            read_joystick_xy_values(&vrx_value_raw, &vry_value_raw);
-            process_joystick_xy_values(vrx_value_raw, vry_value_raw, &rooms[i].humidity,
-                                       &rooms[i].temperature);
-
-            // ativa camera em caso de temperaturas altas
-            rooms[i].cam_on = rooms[i].temperature > 37 ? true : false;
-
-            // Imprime os valores lidos na comunicação serial.
-            printf("Ambiente: %s\n", rooms[i].name);
-            printf("VRX: %u, VRY: %u\n", vrx_value_raw, vry_value_raw);
-            printf("TEMPERATURA: %1.f°, HUMIDADE: %1.f%%\n\n", rooms[i].temperature, rooms[i].humidity);
-
-            // Aciona o alarme em caso de temperaturas muito baixas
-            if (rooms[i].temperature < 7 && !buzzer_a_playing) {
-                buzzer_a_playing = true;
-                play_tone(BUZZER_A_PIN, 300);
-                add_alarm_in_ms(ALARM_DURATION, turn_off_buzzer_alarm_callback, &buzzer_a_data, false);
-
-            // Aciona o alarme em caso de temepratura
-            } else if (rooms[i].temperature > 44 && !buzzer_b_playing) {
-                buzzer_b_playing = true;
-                play_tone(BUZZER_B_PIN, 415);
-                add_alarm_in_ms(ALARM_DURATION, turn_off_buzzer_alarm_callback, &buzzer_b_data, false);
-            }
+    gpio_set_irq_enabled(SW_PIN, GPIO_IRQ_EDGE_FALL | GPIO_IRQ_EDGE_RISE, true);
+
+#if !TELEMETRY_TEXT
+    // A partir daqui a UART leva apenas quadros binários; o texto segue pela USB
+    stdio_set_driver_enabled(&stdio_uart, false);
+    telemetry_init(TELEMETRY_UART);
+#endif
+
+    // Núcleo 0: amostragem, alarmes e telemetria
+    scheduler_init(&core0_scheduler, core0_tasks, count_of(core0_tasks));
+    scheduler_run(&core0_scheduler);
+}
+
+// Laço do núcleo 1: tarefas de renderização
+void core1_main()
+{
+    // Permite ao núcleo 0 pausar este núcleo durante gravações na flash
+    multicore_lockout_victim_init();
+
+    // Inicializados aqui para que as interrupções de DMA sejam servidas neste núcleo
+    init_display(&ssd);
+    widget_screen_init(&text_screen, text_fields, count_of(text_fields));
+    ws2812b_init(LED_MATRIX_PIN); // Inicializa a matriz de LEDs
+    led_anim_init(&matrix_anim);
+
+    scheduler_init(&core1_scheduler, core1_tasks, count_of(core1_tasks));
+    scheduler_run(&core1_scheduler);
+}
+
+// Tarefa: lê os sensores de todos os ambientes
+void sample_task()
+{
+    PROFILE_BEGIN(start_us);
+    for (int i=0; i < rooms.count; i++) {
+        read_joystick_xy_values(&vrx_values_raw[i], &vry_values_raw[i]);
+        process_joystick_xy_values(vrx_values_raw[i], vry_values_raw[i], &rooms.humidity[i],
+                                   &rooms.temperature[i]);
+    }
+    PROFILE_END(&profile_stages[PROF_SAMPLE], start_us);
+    scheduler_notify(&core0_tasks[TASK_ALARM]);
+}
+
+// Tarefa: avalia câmera e alarmes com as leituras mais recentes
+void alarm_task()
+{
+    PROFILE_BEGIN(start_us);
+    alarm_rules_evaluate(room_metrics);
+    PROFILE_END(&profile_stages[PROF_ALARM], start_us);
+
+    // Disparos novos vão para o log em flash
+    for (int i = 0; i < NUM_RULES; i++) {
+        if (alarm_rule_states[i].fired != logged_fired[i]) {
+            scheduler_notify(&core0_tasks[TASK_LOG]);
+            break;
         }
+    }
+}
+
+// Tarefa: registra as leituras atuais no histórico
+void history_task()
+{
+    history_record(&history, room_metrics);
+}
 
-        // Formata a string e armazena em temperature_text
-        snprintf(temperature_text, sizeof(temperature_text), "Temp:%3.0f°", rooms[room_id].temperature);
+// Tarefa: registra no log em flash os alarmes disparados, a troca do modo de
+// gravação total e, a cada LOG_READINGS_PERIOD_MS, as leituras. Os registros
+// ficam no buffer de página e só vão para a flash quando a página enche ou
+// em log_flush_task: uma queda de energia perde no máximo os últimos
+// LOG_FLUSH_MS de registros.
+void log_task()
+{
+    uint32_t now = to_ms_since_boot(get_absolute_time());
+    uint8_t record[6 + LOG_ROOMS_PER_RECORD * 4];
 
-        // Formata a string e armazena em humidity_text
-        snprintf(humidity_text, sizeof(humidity_text), "Hum:%3.0f%%", rooms[room_id].humidity);
+    memcpy(record, &now, 4);
 
-        // Formata a string e armazena em cam_text
-        if (full_recording) { // Ativa modo gravação total
-            snprintf(cam_text, sizeof(cam_text), "Cam: Full On");
+    for (int i = 0; i < NUM_RULES; i++) {
+        if (alarm_rule_states[i].fired != logged_fired[i]) {
+            logged_fired[i] = alarm_rule_states[i].fired;
+            record[4] = i;
+            record[5] = alarm_rules[i].room;
+            log_append(LOG_ALARM, record, 6);
         }
-        else if (rooms[room_id].cam_on) // Ativa a gravação caso a temperatura esteja alta
-        {
-            snprintf(cam_text, sizeof(cam_text), "Cam:On");
+    }
+
+    if (full_recording != logged_full_recording) {
+        logged_full_recording = full_recording;
+        record[4] = logged_full_recording;
+        log_append(LOG_FULL_RECORDING, record, 5);
+    }
+
+    if (now - log_readings_ms >= LOG_READINGS_PERIOD_MS) {
+        log_readings_ms = now;
+        for (int first = 0; first < rooms.count; first += LOG_ROOMS_PER_RECORD) {
+            int count = rooms.count - first < LOG_ROOMS_PER_RECORD ? rooms.count - first : LOG_ROOMS_PER_RECORD;
+            record[4] = first;
+            record[5] = count;
+            for (int i = 0; i < count; i++) {
+                int16_t values[2] = {rooms.temperature[first + i], rooms.humidity[first + i]};
+                memcpy(&record[6 + i * 4], values, 4);
+            }
+            log_append(LOG_READINGS, record, 6 + count * 4);
         }
-        else // Desliga a gravação para temperaturas amenas
-        {
-            snprintf(cam_text, sizeof(cam_text), "Cam:Off");
+    }
+}
+
+// Tarefa: grava a página parcial do log (nada, se não houver registros pendentes)
+void log_flush_task()
+{
+    if (!flash_log_flush(&flash_log))
+        printf("Log: falha ao gravar pagina do log\n");
+}
+
+// Acrescenta um registro ao log, avisando se a flash falhar
+void log_append(uint8_t type, const void *data, uint8_t len)
+{
+    if (!flash_log_append(&flash_log, type, data, len))
+        printf("Log: falha ao gravar registro tipo %u\n", type);
+}
+
+// Monta o log em flash e reproduz os registros: restaura o modo de gravação
+// total e as últimas leituras gravadas
+void init_flash_log()
+{
+    uint32_t counts[LOG_FULL_RECORDING + 1] = {0};
+    uint32_t start_us = time_us_32();
+    uint32_t now = to_ms_since_boot(get_absolute_time());
+
+    flash_log_pico_device(&flash_log_dev);
+    uint32_t replayed = flash_log_mount(&flash_log, &flash_log_dev, replay_log, counts);
+    printf("Log: %lu registros em %lu us (%lu boots, %lu leituras, %lu alarmes), %lu corrompidos\n",
+           (unsigned long)replayed, (unsigned long)(time_us_32() - start_us), (unsigned long)counts[LOG_BOOT],
+           (unsigned long)counts[LOG_READINGS], (unsigned long)counts[LOG_ALARM],
+           (unsigned long)flash_log.records_lost);
+
+    logged_full_recording = full_recording;
+    log_readings_ms = now;
+    flash_log_append(&flash_log, LOG_BOOT, &now, 4);
+}
+
+// Reproduz um registro do log na montagem
+void replay_log(void *ctx, uint8_t type, const uint8_t *data, uint8_t len, uint32_t seq)
+{
+    uint32_t *counts = ctx;
+
+    if (type > LOG_FULL_RECORDING)
+        return;
+    counts[type]++;
+
+    if (type == LOG_FULL_RECORDING && len == 5) {
+        full_recording = data[4];
+    } else if (type == LOG_READINGS && len >= 6 && len == 6 + data[5] * 4) {
+        for (int i = 0; i < data[5] && data[4] + i < rooms.count; i++) {
+            int16_t values[2];
+            memcpy(values, &data[6 + i * 4], 4);
+            rooms.temperature[data[4] + i] = values[0];
+            rooms.humidity[data[4] + i] = values[1];
         }
+    }
+}
+
+// Tarefa: envia ao núcleo 1 uma cópia do ambiente selecionado
+void publish_task()
+{
+    display_snapshot_t snapshot;
+    int id = room_id;
+
+    strcpy(snapshot.name, room_store_name(&rooms, id));
+    snapshot.page.index = id;
+    snapshot.page.count = rooms.count;
+    snapshot.temperature = rooms.temperature[id];
+    snapshot.humidity = rooms.humidity[id];
+    snapshot.cam.on = room_store_cam_on(&rooms, id);
+    snapshot.cam.full_recording = full_recording;
+    snapshot.view = view;
+    snapshot.input_us = input_event_us;
+
+    // Descarta se a fila estiver cheia: o núcleo 1 só usa a cópia mais recente
+    if (spsc_queue_push(&snapshot_queue, &snapshot)) {
+        scheduler_notify(&core1_tasks[TASK_OLED]);
+        scheduler_notify(&core1_tasks[TASK_LED]);
+    }
+}
+
+// Tarefa: nas telas de gráfico, consulta o histórico do ambiente selecionado
+// e envia ao núcleo 1 uma coluna por pixel de cada métrica
+void chart_task()
+{
+    static history_bucket_t points[CHART_MAX_WIDTH];
+    static chart_frame_t frame;
+    uint8_t tier;
+
+    frame.view = view;
+    if (frame.view == VIEW_TEXT)
+        return;
+
+    tier = frame.view - VIEW_CHART_RAW;
+    frame.room = room_id;
+    uint32_t span_ms = history_span_ms(tier);
+    uint16_t count = history_range(&history, frame.room, ALARM_METRIC_TEMPERATURE, span_ms, points, WIDTH);
+    chart_prepare(&frame.temperature, points, count, WIDTH, CHART_HEIGHT);
+    count = history_range(&history, frame.room, ALARM_METRIC_HUMIDITY, span_ms, points, WIDTH);
+    chart_prepare(&frame.humidity, points, count, WIDTH, CHART_HEIGHT);
+
+    if (spsc_queue_push(&chart_queue, &frame))
+        scheduler_notify(&core1_tasks[TASK_OLED]);
+}
+
+// Tarefa: telemetria das leituras e estatísticas pela serial
+void telemetry_task()
+{
+    uint16_t idle[2];
+
+    measure_idle(idle);
+#if TELEMETRY_TEXT
+    print_telemetry(idle);
+#else
+    send_telemetry(idle);
+#endif
+}
+
+// Tarefa: comandos de uma letra pela serial (stdio): 'p' imprime o perfil
+// dos estágios e 'r' zera as estatísticas
+void console_task()
+{
+    int c;
+
+    while ((c = getchar_timeout_us(0)) != PICO_ERROR_TIMEOUT) {
+        if (c == 'p')
+            profile_dump();
+        else if (c == 'r')
+            profile_reset();
+    }
+}
+
+// Tempo ocioso (dormindo em WFE) de cada núcleo desde a última chamada, em
+// centésimos de porcento
+void measure_idle(uint16_t idle[2])
+{
+    static uint32_t window_start_us = 0;
+    static uint32_t window_idle_us[2] = {0, 0};
+    scheduler_t *schedulers[2] = {&core0_scheduler, &core1_scheduler};
+    uint32_t now = time_us_32();
+    uint32_t window_us = now - window_start_us;
+
+    for (int core = 0; core < 2; core++) {
+        uint32_t idle_us = schedulers[core]->idle_us - window_idle_us[core];
+        idle[core] = (uint16_t)((uint64_t)idle_us * 10000 / window_us);
+        window_idle_us[core] += idle_us;
+    }
+    window_start_us = now;
+}
+
+// Quadros binários: leituras de todos os ambientes e estatísticas do sistema,
+// enfileirados na UART sem bloquear
+void send_telemetry(const uint16_t idle[2])
+{
+    static uint8_t payload[TELEMETRY_MAX_PAYLOAD];
+    uint32_t now = to_ms_since_boot(get_absolute_time());
+    uint16_t len = telemetry_header(payload, TELEMETRY_FRAME_SNAPSHOT, now);
+
+    static_assert(TELEMETRY_HEADER_SIZE + 2 + ROOM_STORE_CAPACITY * TELEMETRY_SNAPSHOT_ROOM_SIZE <= TELEMETRY_MAX_PAYLOAD,
+                  "Quadro de leituras excede TELEMETRY_MAX_PAYLOAD");
+    payload[len++] = rooms.count;
+    payload[len++] = full_recording ? TELEMETRY_FLAG_FULL_RECORDING : 0;
+    for (int i = 0; i < rooms.count; i++) {
+        telemetry_put_u16(&payload[len], (uint16_t)rooms.temperature[i]);
+        telemetry_put_u16(&payload[len + 2], (uint16_t)rooms.humidity[i]);
+        payload[len + 4] = room_store_cam_on(&rooms, i) ? TELEMETRY_ROOM_CAM_ON : 0;
+        len += TELEMETRY_SNAPSHOT_ROOM_SIZE;
+    }
+    telemetry_send(payload, len);
+
+    len = telemetry_header(payload, TELEMETRY_FRAME_STATS, now);
+    telemetry_put_u16(&payload[len], idle[0]);
+    telemetry_put_u16(&payload[len + 2], idle[1]);
+    telemetry_put_u32(&payload[len + 4], render_us);
+    telemetry_put_u32(&payload[len + 8], input_latency_us);
+    telemetry_put_u32(&payload[len + 12], ssd.total_bytes);
+    telemetry_put_u32(&payload[len + 16], ws2812b_get_stats().frames_sent);
+    telemetry_put_u32(&payload[len + 20], telemetry_dropped());
+    telemetry_send(payload, TELEMETRY_STATS_SIZE);
+}
+
+// Modo de depuração: leituras e estatísticas em texto
+void print_telemetry(const uint16_t idle[2])
+{
+    char temperature_value[16];
+    char humidity_value[16];
+    char min_value[16], mean_value[16], max_value[16];
+    room_stats_t stats;
+
+    // Uma linha por ambiente, para caber dezenas de ambientes na serial
+    for (int i=0; i < rooms.count; i++) {
+        fixed_format(temperature_value, rooms.temperature[i], 0, 0);
+        fixed_format(humidity_value, rooms.humidity[i], 0, 0);
+        printf("%-9s VRX: %4u VRY: %4u T: %s° H: %s%%%s\n", room_store_name(&rooms, i), vrx_values_raw[i],
+               vry_values_raw[i], temperature_value, humidity_value, room_store_cam_on(&rooms, i) ? " CAM" : "");
+    }
+
+    // Estatísticas de cada métrica, varrendo um único vetor por vez
+    room_store_stats(rooms.temperature, rooms.count, &stats);
+    fixed_format(min_value, stats.min, 1, 0);
+    fixed_format(mean_value, stats.mean, 1, 0);
+    fixed_format(max_value, stats.max, 1, 0);
+    printf("TEMPERATURA: min %s° (%s), media %s°, max %s° (%s)\n", min_value, room_store_name(&rooms, stats.min_room),
+           mean_value, max_value, room_store_name(&rooms, stats.max_room));
+    room_store_stats(rooms.humidity, rooms.count, &stats);
+    fixed_format(min_value, stats.min, 1, 0);
+    fixed_format(mean_value, stats.mean, 1, 0);
+    fixed_format(max_value, stats.max, 1, 0);
+    printf("HUMIDADE: min %s%% (%s), media %s%%, max %s%% (%s)\n\n", min_value, room_store_name(&rooms, stats.min_room),
+           mean_value, max_value, room_store_name(&rooms, stats.max_room));
+
+    printf("Historico: %u brutas, %u minutos, %u horas\n\n", history_available(&history, HISTORY_TIER_RAW),
+           history_available(&history, HISTORY_TIER_MINUTE), history_available(&history, HISTORY_TIER_HOUR));
+
+    printf("OLED: %lu bytes no frame, %lu bytes em %lu frames\n", (unsigned long)ssd.frame_bytes,
+           (unsigned long)ssd.total_bytes, (unsigned long)ssd.frames_sent);
+    printf("OLED: render %lu us (%lu ciclos)\n", (unsigned long)render_us,
+           (unsigned long)(render_us * (clock_get_hz(clk_sys) / 1000000)));
+    // Do último frame concluído (leitura sem trava: pode misturar dois frames, aceitável para diagnóstico)
+    printf("OLED: ultimo frame: CPU %lu us, barramento %lu us, CPU liberada %ld us\n", (unsigned long)ssd.send_cpu_us,
+           (unsigned long)ssd.send_busy_us, (long)ssd.send_busy_us - (long)ssd.send_cpu_us);
+    printf("OLED: latencia botao -> frame %lu us\n\n", (unsigned long)input_latency_us);
+
+    ws2812b_stats_t led_stats = ws2812b_get_stats();
+    printf("LEDs: %lu frames pedidos, %lu enviados\n\n", (unsigned long)led_stats.frames_requested,
+           (unsigned long)led_stats.frames_sent);
+
+    for (int core = 0; core < 2; core++)
+        printf("CPU: nucleo %d ocioso %u.%02u%%\n", core, idle[core] / 100, idle[core] % 100);
+    printf("\n");
+}
+
+// Atualiza a cópia local com a mais recente recebida do núcleo 0
+void receive_snapshot()
+{
+    while (spsc_queue_pop(&snapshot_queue, &current_snapshot))
+        ;
+}
+
+// Tarefa: redesenha o display OLED
+void oled_task()
+{
+    static uint32_t last_input_us = 0;
+    static uint8_t drawn_view = NUM_VIEWS; // Tela presente no buffer do display
+
+    receive_snapshot();
 
-        // Desenha as informações no display SSD1306
+    // Troca de tela: limpa o buffer e redesenha todos os campos
+    if (current_snapshot.view != drawn_view) {
+        drawn_view = current_snapshot.view;
         ssd1306_fill(&ssd, false);
-        ssd1306_draw_string(&ssd, rooms[room_id].name, 30, 4);
-        ssd1306_draw_string(&ssd, temperature_text, 30, 26);
-        ssd1306_draw_string(&ssd, humidity_text, 30, 37);
-        ssd1306_draw_string(&ssd, cam_text, 30, 55);
-        ssd1306_send_data(&ssd); // Atualiza o display
+        widget_invalidate(&text_screen);
+    }
+
+    // Desenha a tela selecionada no display SSD1306
+    uint32_t render_start_us = time_us_32();
+    if (current_snapshot.view == VIEW_TEXT)
+        draw_text_view();
+    else
+        draw_chart_view();
+    render_us = time_us_32() - render_start_us;
+    PROFILE_END(&profile_stages[PROF_RENDER], render_start_us);
+
+    PROFILE_BEGIN(send_start_us);
+    ssd1306_flip(&ssd); // Entrega o frame ao DMA (apenas a região alterada)
+    PROFILE_END(&profile_stages[PROF_OLED_SEND], send_start_us);
+
+    // Latência do último botão até o frame ser entregue ao DMA
+    if (current_snapshot.input_us != last_input_us) {
+        last_input_us = current_snapshot.input_us;
+        input_latency_us = time_us_32() - last_input_us;
+    }
+}
+
+// Tela de texto: leituras atuais do ambiente selecionado. Em regime, sem
+// mudança nas leituras, não formata nem desenha nada.
+void draw_text_view()
+{
+    widget_update(&ssd, &text_screen);
+}
+
+void format_name(char *text, const void *value)
+{
+    snprintf(text, WIDGET_TEXT_MAX + 1, "%s", (const char *)value);
+}
 
-        // Mostra o nivel da temperatura na matriz de LED
-        draw_temperature_level(rooms[room_id].temperature);
+// Posição do ambiente entre todos os instalados
+void format_page(char *text, const void *value)
+{
+    const display_page_t *page = value;
+    snprintf(text, WIDGET_TEXT_MAX + 1, "%02u de %02u", page->index + 1, page->count);
+}
+
+// Leitura principal, na fonte grande: sem preenchimento, para não gastar
+// colunas largas com espaços
+void format_temperature(char *text, const void *value)
+{
+    char number[12];
+    fixed_format(number, *(const centi_t *)value, 0, 0);
+    snprintf(text, WIDGET_TEXT_MAX + 1, "%s°C", number);
+}
 
-        // Blinka o nível da umidade do ar
-        blink_humidity_level(rooms[room_id].humidity);
+void format_humidity(char *text, const void *value)
+{
+    char number[12];
+    fixed_format(number, *(const centi_t *)value, 0, 3);
+    snprintf(text, WIDGET_TEXT_MAX + 1, "%s%%", number);
+}
+
+void format_cam(char *text, const void *value)
+{
+    const display_cam_t *cam = value;
+    if (cam->full_recording) // Ativa modo gravação total
+        snprintf(text, WIDGET_TEXT_MAX + 1, " Full On");
+    else if (cam->on) // Ativa a gravação caso a temperatura esteja alta
+        snprintf(text, WIDGET_TEXT_MAX + 1, "On");
+    else // Desliga a gravação para temperaturas amenas
+        snprintf(text, WIDGET_TEXT_MAX + 1, "Off");
+}
 
-        sleep_ms(500);
+// Tela de gráfico: histórico de temperatura e umidade do ambiente selecionado,
+// com a faixa de cada escala. Desenhar custa uma coluna por pixel.
+void draw_chart_view()
+{
+    char title_text[20];
+    char range_text[20];
+    char low_value[16];
+    char high_value[16];
+
+    while (spsc_queue_pop(&chart_queue, &current_chart))
+        ;
+
+    // Intervalo coberto pela camada do histórico exibida
+    uint8_t tier = current_snapshot.view - VIEW_CHART_RAW;
+    uint32_t span_s = history_span_ms(tier) / 1000;
+    if (span_s % 86400 == 0)
+        snprintf(title_text, sizeof(title_text), "%s %lud", current_snapshot.name, (unsigned long)(span_s / 86400));
+    else if (span_s % 3600 == 0)
+        snprintf(title_text, sizeof(title_text), "%s %luh", current_snapshot.name, (unsigned long)(span_s / 3600));
+    else
+        snprintf(title_text, sizeof(title_text), "%s %lumin", current_snapshot.name, (unsigned long)(span_s / 60));
+
+    ssd1306_fill(&ssd, false);
+    ssd1306_draw_string(&ssd, title_text, 0, 0);
+
+    // O gráfico pode ser de outro ambiente ou tela até o núcleo 0 publicar o novo
+    if (current_chart.room != current_snapshot.page.index || current_chart.view != current_snapshot.view)
+        return;
+    if (current_chart.temperature.width == 0) {
+        ssd1306_draw_string(&ssd, "Sem dados", 0, 24);
+        return;
     }
+
+    fixed_format(low_value, current_chart.temperature.low, 0, 0);
+    fixed_format(high_value, current_chart.temperature.high, 0, 0);
+    snprintf(range_text, sizeof(range_text), "T %s a %s°", low_value, high_value);
+    ssd1306_draw_string(&ssd, range_text, 0, 8);
+    chart_draw(&ssd, &current_chart.temperature, 0, 16);
+
+    fixed_format(low_value, current_chart.humidity.low, 0, 0);
+    fixed_format(high_value, current_chart.humidity.high, 0, 0);
+    snprintf(range_text, sizeof(range_text), "H %s a %s%%", low_value, high_value);
+    ssd1306_draw_string(&ssd, range_text, 0, 16 + CHART_HEIGHT);
+    chart_draw(&ssd, &current_chart.humidity, 0, 24 + CHART_HEIGHT);
+}
+
+// Tarefa: atualiza a matriz de LEDs e o LED RGB
+void led_task()
+{
+    receive_snapshot();
+
+    // Mostra a temperatura rolando na matriz de LED
+    scroll_temperature(current_snapshot.temperature);
+
+    // Blinka o nível da umidade do ar
+    blink_humidity_level(current_snapshot.humidity);
 }
 
 // Inicializa um led em um pino específico
@@ -213,7 +815,7 @@ void init_i2c()
 // Inicializa o display OLED
 void init_display(ssd1306_t *ssd)
 {
-    ssd1306_init(ssd, WIDTH, HEIGHT, false, I2C_ADDRESS, I2C_PORT);
+    ssd1306_init(ssd, WIDTH, HEIGHT, false, I2C_ADDRESS, I2C_PORT, &display_buffers);
     ssd1306_config(ssd);
     ssd1306_send_data(ssd);
 
@@ -228,93 +830,70 @@ void init_joystick()
     adc_gpio_init(VRX_PIN);
     adc_gpio_init(VRY_PIN);
 
-    init_btn(SW_PIN);
-}
-
-// Inicializa o PWM no pino do buzzer
-void pwm_init_buzzer(uint pin) {
-    gpio_set_function(pin, GPIO_FUNC_PWM);
-    uint slice_num = pwm_gpio_to_slice_num(pin);
-    pwm_config config = pwm_get_default_config();
-    pwm_config_set_clkdiv(&config, 4.0f); // Ajusta divisor de clock
-    pwm_init(slice_num, &config, true);
-    pwm_set_gpio_level(pin, 0); // Desliga o PWM inicialmente
-}
+    // Amostragem contínua dos dois eixos em segundo plano (ADC + DMA)
+    adc_sampler_init((1u << ADC_VRX_INPUT) | (1u << ADC_VRY_INPUT), ADC_SAMPLE_RATE_HZ);
+    adc_sampler_set_oversampling(ADC_VRX_INPUT, ADC_OVERSAMPLE_RATIO);
+    adc_sampler_set_oversampling(ADC_VRY_INPUT, ADC_OVERSAMPLE_RATIO);
 
-// Toca uma nota com a frequência e duração especificadas
-void play_tone(uint pin, uint frequency) {
-    uint slice_num = pwm_gpio_to_slice_num(pin);
-    uint32_t clock_freq = clock_get_hz(clk_sys);
-    uint32_t top = clock_freq / frequency - 1;
+    // Aguarda o buffer encher e mede o custo de cada leitura decimada
+    sleep_ms(ADC_OVERSAMPLE_RATIO * 1000 / ADC_SAMPLE_RATE_HZ + 1);
+    printf("ADC: %ux -> %u bits, %lu ciclos por leitura\n", ADC_OVERSAMPLE_RATIO,
+           adc_sampler_resolution(ADC_VRX_INPUT), (unsigned long)adc_sampler_decimation_cycles(ADC_VRX_INPUT, 100));
 
-    pwm_set_wrap(slice_num, top);
-    pwm_set_gpio_level(pin, top / 2); // 50% de duty cycle
+    init_btn(SW_PIN);
 }
 
-// Realiza a amostragem e atualiza os valores X e Y do joystick
+// Atualiza os valores X e Y do joystick com as últimas amostras sobreamostradas, sem bloquear
 void read_joystick_xy_values(uint16_t *x_value, uint16_t *y_value)
 {
-    adc_select_input(1); // Seleciona o ADC para eixo X. O pino 26 como entrada analógica
-    *x_value = adc_read();
-    sleep_us(20);
-
-    adc_select_input(0); // Seleciona o ADC para eixo Y. O pino 27 como entrada analógica
-    *y_value = adc_read();
-    sleep_us(20);
+    *x_value = adc_sampler_decimated(ADC_VRX_INPUT);
+    *y_value = adc_sampler_decimated(ADC_VRY_INPUT);
 }
 
 // Processa os valores de X e Y para a posição correto no display
-void process_joystick_xy_values(uint16_t x_value_raw, uint16_t y_value_raw, float *x_value, float *y_value)
+void process_joystick_xy_values(uint16_t x_value_raw, uint16_t y_value_raw, centi_t *x_value, centi_t *y_value)
 {
-    *x_value = 100 * (float)x_value_raw / ADC_MAX_VALUE;
-    *y_value = MAX_TEMP * (float)y_value_raw / ADC_MAX_VALUE;
+    // Fundo de escala conforme a resolução após a decimação, em centésimos
+    *x_value = fixed_from_adc(x_value_raw, adc_sampler_resolution(ADC_VRX_INPUT), 100);
+    *y_value = fixed_from_adc(y_value_raw, adc_sampler_resolution(ADC_VRY_INPUT), MAX_TEMP);
 }
 
-// Desenha o nível de temperatura na matriz de LED
-void draw_temperature_level(float temperature)
+// Agenda a temperatura para rolar na matriz de LED, na cor da faixa:
+// azul até 18°, verde até 33° e vermelho acima
+void scroll_temperature(centi_t temperature)
 {
-    ws2812b_clear();
-
-    if (temperature >= 0) {
-        for (int i=0; i < 5; i++) {
-            ws2812b_set_led(i, 0, 0, 8);
-        }
-    }
+    char value[12];
+    char text[LED_ANIM_TEXT_MAX + 1];
 
-    if (temperature >= 10) {
-        for (int i=5; i < 10; i++) {
-            ws2812b_set_led(i, 0, 0, 8);
-        }
-    }
-
-    if (temperature >= 18) {
-        for (int i=10; i < 15; i++) {
-            ws2812b_set_led(i, 0, 8, 0);
-        }
-    }
+    fixed_format(value, temperature, 1, 0);
+    snprintf(text, sizeof(text), "%s°", value);
 
-    if (temperature >= 33) {
-        for (int i=15; i < 20; i++) {
-            ws2812b_set_led(i, 8, 0, 0);
-        }
+    if (temperature < CENTI(18)) {
+        led_anim_set_text(&matrix_anim, text, 0, 0, 200);
+    } else if (temperature < CENTI(33)) {
+        led_anim_set_text(&matrix_anim, text, 0, 200, 0);
+    } else {
+        led_anim_set_text(&matrix_anim, text, 200, 0, 0);
     }
+}
 
-    if (temperature >= 42) {
-        for (int i=20; i < 25; i++) {
-            ws2812b_set_led(i, 8, 0, 0);
-        }
-    }
+// Tarefa: avança a animação da matriz um frame, a período fixo
+void matrix_task()
+{
+    led_anim_frame(&matrix_anim);
 
+    PROFILE_BEGIN(write_start_us);
     ws2812b_write();
+    PROFILE_END(&profile_stages[PROF_LED_WRITE], write_start_us);
 }
 
 // Blinka o nível da umidade do ar
-void blink_humidity_level(float humidity) {
-    if (humidity >= 0 && humidity < 40) {
+void blink_humidity_level(centi_t humidity) {
+    if (humidity >= CENTI(0) && humidity < CENTI(40)) {
         gpio_put(GREEN_LED_PIN, false);
         gpio_put(BLUE_LED_PIN, true);
         gpio_put(RED_LED_PIN, false);
-    } else if (humidity >= 40 && humidity < 70) {
+    } else if (humidity >= CENTI(40) && humidity < CENTI(70)) {
         gpio_put(GREEN_LED_PIN, true);
         gpio_put(BLUE_LED_PIN, false);
         gpio_put(RED_LED_PIN, false);
@@ -330,47 +909,109 @@ void gpio_irq_handler(uint gpio, uint32_t events) {
     int64_t current_time = to_ms_since_boot(get_absolute_time());
 
     if (gpio == BTN_A_PIN && current_time - last_valid_press_time_btn_a > 250) {
-        room_id = room_id - 1 >= 0 ? room_id - 1: 0;
+        room_id = room_id > 0 ? room_id - 1 : rooms.count - 1; // Circular: do primeiro volta ao último
         last_valid_press_time_btn_a = to_ms_since_boot(get_absolute_time());
 
     } else if (gpio == BTN_B_PIN && current_time - last_valid_press_time_btn_b > 250) {
-        room_id = room_id + 1 <= NUM_ROOM - 1 ? room_id + 1: NUM_ROOM - 1;
+        room_id = room_id + 1 < rooms.count ? room_id + 1 : 0;
         last_valid_press_time_btn_b = to_ms_since_boot(get_absolute_time());
 
-    } else if (gpio == SW_PIN && current_time - last_valid_press_time_sw > 250) {
-        full_recording = !full_recording;
-        last_valid_press_time_sw = to_ms_since_boot(get_absolute_time());
+    } else if (gpio == SW_PIN && (events & GPIO_IRQ_EDGE_FALL) && current_time - last_valid_press_time_sw > 250) {
+        // Apenas marca o início: a ação depende da duração da pressão
+        sw_press_time = current_time;
+        last_valid_press_time_sw = current_time;
+        return;
+
+    } else if (gpio == SW_PIN && (events & GPIO_IRQ_EDGE_RISE) && sw_press_time >= 0) {
+        // Pressão curta: gravação total; pressão longa: próxima tela (texto e gráficos)
+        if (current_time - sw_press_time >= SW_LONG_PRESS_MS) {
+            view = (view + 1) % NUM_VIEWS;
+        } else {
+            full_recording = !full_recording;
+            scheduler_notify(&core0_tasks[TASK_LOG]);
+        }
+        sw_press_time = -1;
+
+    } else {
+        return;
     }
-}
 
-// Função de callback para desligar o alarme após X segundos
-int64_t turn_off_buzzer_alarm_callback(alarm_id_t id, void *user_data) {
-    if (user_data != NULL) {
-        buzzer_data_t *data = (buzzer_data_t *)user_data;
+    // Publica imediatamente para o display refletir o botão
+    input_event_us = time_us_32();
+    scheduler_notify(&core0_tasks[TASK_PUBLISH]);
+    scheduler_notify(&core0_tasks[TASK_CHART]);
+}
 
-        if (data->buzzer_id == 1) {
-            pwm_set_gpio_level(BUZZER_A_PIN, 0);
-            add_alarm_in_ms(ALARM_DELAY, buzzer_reset_state_alarm_callback, &buzzer_a_data, false);
-        } else if (data->buzzer_id == 2) {
-            pwm_set_gpio_level(BUZZER_B_PIN, 0);
-            add_alarm_in_ms(ALARM_DELAY, buzzer_reset_state_alarm_callback, &buzzer_b_data, false);
+// Cadastra os ambientes; os nomes vão para a tabela internada do armazenamento
+void init_rooms()
+{
+    static const char *const named[] = {"Sala", "Quarto", "Cozinha"};
+    char name[ROOM_NAME_MAX];
+
+    room_store_init(&rooms);
+    for (int i = 0; i < NUM_ROOM; i++) {
+        if (i < count_of(named)) {
+            room_store_add(&rooms, named[i]);
+        } else {
+            snprintf(name, sizeof(name), "Zona %02d", i + 1);
+            room_store_add(&rooms, name);
         }
     }
+}
+
+// Liga as ações das regras aos buzzers e às câmeras e monta a tabela de
+// regras compartilhada com o benchmark do host (build_alarm_rules)
+void init_alarm_rules()
+{
+    alarm_actions[ACTION_BUZZER_A] = (alarm_action_t){alarm_buzzer_start, alarm_buzzer_stop, BUZZER_A};
+    alarm_actions[ACTION_BUZZER_B] = (alarm_action_t){alarm_buzzer_start, alarm_buzzer_stop, BUZZER_B};
+    for (int i = 0; i < NUM_ROOM; i++)
+        alarm_actions[ACTION_CAMERA + i] = (alarm_action_t){camera_start, camera_stop, i};
+
+    build_alarm_rules(alarm_rules);
+    alarm_rules_init(alarm_rules, alarm_rule_states, NUM_RULES, alarm_actions, alarm_action_refs, NUM_ACTIONS);
+}
+
+// Ações dos buzzers: o padrão de aviso toca em laço pelo DMA e um único
+// temporizador por alarme (não por nota) o troca pelo urgente. As
+// interrupções ficam desabilitadas para que uma parada vinda de um
+// temporizador não deixe a escalada agendada.
+void alarm_buzzer_start(uint32_t buzzer)
+{
+    uint32_t irq = save_and_disable_interrupts();
+    if (buzzer_escalation[buzzer] > 0)
+        cancel_alarm(buzzer_escalation[buzzer]);
+    buzzer_play(&buzzers[buzzer], &alarm_patterns[buzzer][URGENCY_WARNING]);
+    buzzer_escalation[buzzer] =
+        add_alarm_in_ms(ALARM_ESCALATE_MS, alarm_buzzer_escalate, (void *)(uintptr_t)buzzer, false);
+    restore_interrupts(irq);
+}
 
+int64_t alarm_buzzer_escalate(alarm_id_t id, void *user_data)
+{
+    uint32_t buzzer = (uintptr_t)user_data;
+    buzzer_escalation[buzzer] = 0;
+    buzzer_play(&buzzers[buzzer], &alarm_patterns[buzzer][URGENCY_URGENT]);
     return 0;
 }
 
-// Função de callback para reiniciar o estado do alarme para false após X minutos
-int64_t buzzer_reset_state_alarm_callback(alarm_id_t id, void *user_data) {
-    if (user_data != NULL) {
-        buzzer_data_t *data = (buzzer_data_t *)user_data;
+void alarm_buzzer_stop(uint32_t buzzer)
+{
+    uint32_t irq = save_and_disable_interrupts();
+    if (buzzer_escalation[buzzer] > 0)
+        cancel_alarm(buzzer_escalation[buzzer]);
+    buzzer_escalation[buzzer] = 0;
+    buzzer_stop(&buzzers[buzzer]);
+    restore_interrupts(irq);
+}
 
-        if (data->buzzer_id == 1) {
-            buzzer_a_playing = false;
-        } else if (data->buzzer_id == 2) {
-            buzzer_b_playing = false;
-        }
-    }
+// Ações da câmera: liga e desliga a gravação de um ambiente
+void camera_start(uint32_t room)
+{
+    room_store_set_cam(&rooms, room, true);
+}
 
-    return 0;
+void camera_stop(uint32_t room)
+{
+    room_store_set_cam(&rooms, room, false);
 }
@@ -0,0 +1,212 @@
+// Ferramenta do host para o log em flash (lib/flash_log.c), sobre um
+// simulador de flash NOR em arquivo: gravar só zera bits de páginas
+// apagadas e apagar devolve o setor inteiro a 0xFF.
+//
+// Compilar: cc -O2 -Wall -o flash_log_tool tools/flash_log_tool.c lib/flash_log.c
+// Usar:     ./flash_log_tool dump imagem.bin
+//               Lista os registros de uma imagem da região do log
+//               (ex.: picotool save -r 0x101F0000 0x10200000 imagem.bin)
+//           ./flash_log_tool stress imagem.bin [ciclos]
+//               Grava registros com quedas de energia aleatórias no meio
+//               das gravações e confere a recuperação após cada reinício
+
+#include <setjmp.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "../lib/flash_log.h"
+
+#define REGION_SIZE (64 * 1024)
+#define SECTOR_SIZE 4096
+#define SECTORS (REGION_SIZE / SECTOR_SIZE)
+
+typedef struct
+{
+    uint8_t data[REGION_SIZE];
+    uint32_t erases[SECTORS];
+    long ops_until_cut; // Operações até a próxima queda de energia (-1: nunca)
+    jmp_buf cut;
+} flash_sim_t;
+
+static bool sim_read(void *ctx, uint32_t offset, void *dst, uint32_t len)
+{
+    flash_sim_t *sim = ctx;
+    memcpy(dst, &sim->data[offset], len);
+    return true;
+}
+
+// Queda de energia no meio da operação: só parte da página é gravada.
+static bool sim_program(void *ctx, uint32_t offset, const void *page)
+{
+    flash_sim_t *sim = ctx;
+    const uint8_t *src = page;
+    uint32_t len = FLASH_LOG_PAGE_SIZE;
+    bool cut = sim->ops_until_cut >= 0 && sim->ops_until_cut-- == 0;
+
+    if (cut)
+        len = rand() % FLASH_LOG_PAGE_SIZE;
+    for (uint32_t i = 0; i < len; ++i)
+        sim->data[offset + i] &= src[i];
+    if (cut)
+        longjmp(sim->cut, 1);
+    return true;
+}
+
+static bool sim_erase(void *ctx, uint32_t offset)
+{
+    flash_sim_t *sim = ctx;
+    bool cut = sim->ops_until_cut >= 0 && sim->ops_until_cut-- == 0;
+
+    memset(&sim->data[offset], 0xFF, cut ? rand() % SECTOR_SIZE : SECTOR_SIZE);
+    sim->erases[offset / SECTOR_SIZE]++;
+    if (cut)
+        longjmp(sim->cut, 1);
+    return true;
+}
+
+static flash_sim_t sim;
+static const flash_log_dev_t sim_dev = {REGION_SIZE, SECTOR_SIZE, sim_read, sim_program, sim_erase, &sim};
+
+static void load(const char *path)
+{
+    FILE *file = fopen(path, "rb");
+
+    memset(sim.data, 0xFF, sizeof(sim.data));
+    if (file != NULL)
+    {
+        fread(sim.data, 1, sizeof(sim.data), file);
+        fclose(file);
+    }
+}
+
+static void save(const char *path)
+{
+    FILE *file = fopen(path, "wb");
+
+    if (file == NULL || fwrite(sim.data, 1, sizeof(sim.data), file) != sizeof(sim.data))
+        perror(path);
+    if (file != NULL)
+        fclose(file);
+}
+
+static void print_record(void *ctx, uint8_t type, const uint8_t *data, uint8_t len, uint32_t seq)
+{
+    (void)ctx;
+    printf("%8u tipo %3u %3u bytes:", seq, type, len);
+    for (uint8_t i = 0; i < len; ++i)
+        printf(" %02x", data[i]);
+    printf("\n");
+}
+
+// Conteúdo dos registros do teste, derivado da sequência.
+static uint8_t stress_len(uint32_t seq)
+{
+    return seq % 97 + 1;
+}
+
+static uint8_t stress_byte(uint32_t seq, uint8_t i)
+{
+    return (uint8_t)(seq * 31 + i);
+}
+
+typedef struct
+{
+    uint32_t count;
+    uint32_t last_seq;
+    uint32_t errors;
+} stress_check_t;
+
+static void check_record(void *ctx, uint8_t type, const uint8_t *data, uint8_t len, uint32_t seq)
+{
+    stress_check_t *check = ctx;
+    bool ok = type == 1 && len == stress_len(seq) && (check->count == 0 || seq > check->last_seq);
+
+    for (uint8_t i = 0; ok && i < len; ++i)
+        ok = data[i] == stress_byte(seq, i);
+    if (!ok)
+        check->errors++;
+    check->count++;
+    check->last_seq = seq;
+}
+
+static int stress(const char *path, long cycles)
+{
+    static flash_log_t log;
+    volatile uint32_t committed = 0; // Maior sequência confirmada por flash_log_flush
+    volatile bool any_committed = false;
+    volatile uint32_t failures = 0;
+
+    for (volatile long cycle = 0; cycle < cycles; ++cycle)
+    {
+        stress_check_t check = {0};
+
+        sim.ops_until_cut = -1;
+        flash_log_mount(&log, &sim_dev, check_record, &check);
+        if (check.errors > 0 || (any_committed && (check.count == 0 || check.last_seq < committed)))
+        {
+            printf("ciclo %ld: %u registros, %u invalidos, ultimo %u, confirmado %u\n", cycle, check.count,
+                   check.errors, check.last_seq, committed);
+            failures++;
+        }
+
+        // Grava até a próxima queda de energia
+        sim.ops_until_cut = rand() % 64;
+        if (setjmp(sim.cut) == 0)
+        {
+            for (;;)
+            {
+                uint32_t seq = log.seq;
+                uint8_t data[FLASH_LOG_MAX_DATA];
+                for (uint8_t i = 0; i < stress_len(seq); ++i)
+                    data[i] = stress_byte(seq, i);
+                flash_log_append(&log, 1, data, stress_len(seq));
+                if (rand() % 8 == 0 && log.fill > 0)
+                {
+                    uint32_t last = log.seq - 1;
+                    flash_log_flush(&log);
+                    committed = last;
+                    any_committed = true;
+                }
+            }
+        }
+    }
+
+    uint32_t min = sim.erases[0], max = sim.erases[0];
+    for (int s = 1; s < SECTORS; ++s)
+    {
+        if (sim.erases[s] < min)
+            min = sim.erases[s];
+        if (sim.erases[s] > max)
+            max = sim.erases[s];
+    }
+    printf("%ld ciclos, %u falhas, apagamentos por setor: min %u, max %u\n", cycles, failures, min, max);
+    save(path);
+    return failures > 0;
+}
+
+int main(int argc, char **argv)
+{
+    static flash_log_t log;
+
+    if (argc < 3)
+    {
+        fprintf(stderr, "uso: %s dump|stress imagem.bin [ciclos]\n", argv[0]);
+        return 2;
+    }
+
+    load(argv[2]);
+    sim.ops_until_cut = -1;
+
+    if (strcmp(argv[1], "dump") == 0)
+    {
+        uint32_t count = flash_log_mount(&log, &sim_dev, print_record, NULL);
+        printf("%u registros, %u corrompidos, setor %u, pagina %u\n", count, log.records_lost, log.sector, log.page);
+        return 0;
+    }
+    if (strcmp(argv[1], "stress") == 0)
+        return stress(argv[2], argc > 3 ? atol(argv[3]) : 1000);
+
+    fprintf(stderr, "comando desconhecido: %s\n", argv[1]);
+    return 2;
+}
@@ -0,0 +1,185 @@
+// Decodificador da telemetria binária para Linux.
+//
+// Compilar: cc -O2 -Wall -o telemetry_decode tools/telemetry_decode.c
+// Usar:     ./telemetry_decode /dev/ttyUSB0   (configura 115200 8N1)
+//           ./telemetry_decode captura.bin    (arquivo gravado da serial)
+//           ./telemetry_decode < captura.bin
+//
+// Cada quadro é separado por 0x00, decodificado (COBS), conferido pelo
+// CRC-16 e impresso em texto. Bytes fora de quadros (ex.: mensagens de boot)
+// e quadros corrompidos são contados e descartados.
+
+#define _DEFAULT_SOURCE // cfmakeraw (termios.h) fora do C padrão
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+#include <termios.h>
+#include <unistd.h>
+
+#include "../lib/telemetry_protocol.h"
+
+#define FRAME_MAX (TELEMETRY_MAX_PAYLOAD + TELEMETRY_CRC_SIZE + TELEMETRY_MAX_PAYLOAD / 254 + 2)
+
+static unsigned long frames_ok = 0, frames_bad = 0;
+
+// Decodifica um quadro COBS (sem o delimitador); retorna o tamanho ou -1.
+static int cobs_decode(const uint8_t *in, size_t len, uint8_t *out)
+{
+    size_t i = 0, n = 0;
+
+    while (i < len)
+    {
+        uint8_t code = in[i++];
+        if (code == 0 || i + code - 1 > len)
+            return -1;
+        for (uint8_t k = 1; k < code; ++k)
+            out[n++] = in[i++];
+        if (code != 0xFF && i < len)
+            out[n++] = 0;
+    }
+    return (int)n;
+}
+
+// Valor em centésimos com sinal, formatado com duas casas.
+static void print_centi(int16_t value)
+{
+    int v = value < 0 ? -value : value;
+    printf("%s%d.%02d", value < 0 ? "-" : "", v / 100, v % 100);
+}
+
+static void print_snapshot(const uint8_t *p, int len, uint32_t timestamp)
+{
+    uint8_t rooms = p[TELEMETRY_HEADER_SIZE];
+    uint8_t flags = p[TELEMETRY_HEADER_SIZE + 1];
+    const uint8_t *room = &p[TELEMETRY_HEADER_SIZE + 2];
+
+    if (len != TELEMETRY_HEADER_SIZE + 2 + rooms * TELEMETRY_SNAPSHOT_ROOM_SIZE)
+    {
+        frames_bad++;
+        return;
+    }
+
+    printf("[%10u ms] %u ambientes%s\n", timestamp, rooms,
+           flags & TELEMETRY_FLAG_FULL_RECORDING ? ", gravacao total" : "");
+    for (uint8_t i = 0; i < rooms; ++i, room += TELEMETRY_SNAPSHOT_ROOM_SIZE)
+    {
+        printf("  %2u: T ", i + 1);
+        print_centi((int16_t)telemetry_get_u16(room));
+        printf(" H ");
+        print_centi((int16_t)telemetry_get_u16(room + 2));
+        printf("%s\n", room[4] & TELEMETRY_ROOM_CAM_ON ? " CAM" : "");
+    }
+}
+
+static void print_stats(const uint8_t *p, int len, uint32_t timestamp)
+{
+    const uint8_t *s = &p[TELEMETRY_HEADER_SIZE];
+
+    if (len != TELEMETRY_STATS_SIZE)
+    {
+        frames_bad++;
+        return;
+    }
+
+    printf("[%10u ms] ocioso %u.%02u%% / %u.%02u%%, render %u us, latencia %u us, OLED %u bytes, "
+           "LEDs %u frames, descartados %u\n",
+           timestamp, telemetry_get_u16(s) / 100, telemetry_get_u16(s) % 100, telemetry_get_u16(s + 2) / 100,
+           telemetry_get_u16(s + 2) % 100, telemetry_get_u32(s + 4), telemetry_get_u32(s + 8),
+           telemetry_get_u32(s + 12), telemetry_get_u32(s + 16), telemetry_get_u32(s + 20));
+}
+
+static void handle_frame(const uint8_t *frame, size_t len)
+{
+    uint8_t payload[FRAME_MAX];
+    int n = cobs_decode(frame, len, payload);
+
+    if (n < TELEMETRY_HEADER_SIZE + TELEMETRY_CRC_SIZE)
+    {
+        frames_bad++;
+        return;
+    }
+    n -= TELEMETRY_CRC_SIZE;
+    if (telemetry_crc16(payload, n) != telemetry_get_u16(&payload[n]) || payload[1] != TELEMETRY_VERSION)
+    {
+        frames_bad++;
+        return;
+    }
+
+    frames_ok++;
+    uint32_t timestamp = telemetry_get_u32(&payload[2]);
+    switch (payload[0])
+    {
+    case TELEMETRY_FRAME_SNAPSHOT:
+        print_snapshot(payload, n, timestamp);
+        break;
+    case TELEMETRY_FRAME_STATS:
+        print_stats(payload, n, timestamp);
+        break;
+    default:
+        printf("[%10u ms] quadro tipo %u (%d bytes)\n", timestamp, payload[0], n);
+        break;
+    }
+    fflush(stdout);
+}
+
+// Configura uma porta serial em modo bruto, 115200 8N1.
+static void configure_tty(int fd)
+{
+    struct termios tty;
+
+    if (tcgetattr(fd, &tty) != 0)
+        return; // Arquivo comum
+    cfmakeraw(&tty);
+    cfsetispeed(&tty, B115200);
+    cfsetospeed(&tty, B115200);
+    tty.c_cflag |= CLOCAL | CREAD;
+    tcsetattr(fd, TCSANOW, &tty);
+}
+
+int main(int argc, char **argv)
+{
+    int fd = STDIN_FILENO;
+    uint8_t buffer[256];
+    uint8_t frame[FRAME_MAX];
+    size_t frame_len = 0;
+    bool overflow = false;
+    ssize_t n;
+
+    if (argc > 1)
+    {
+        fd = open(argv[1], O_RDONLY | O_NOCTTY);
+        if (fd < 0)
+        {
+            fprintf(stderr, "%s: %s\n", argv[1], strerror(errno));
+            return 1;
+        }
+        configure_tty(fd);
+    }
+
+    while ((n = read(fd, buffer, sizeof(buffer))) > 0)
+    {
+        for (ssize_t i = 0; i < n; ++i)
+        {
+            if (buffer[i] != 0)
+            {
+                if (frame_len < sizeof(frame))
+                    frame[frame_len++] = buffer[i];
+                else
+                    overflow = true;
+                continue;
+            }
+            if (overflow)
+                frames_bad++;
+            else if (frame_len > 0)
+                handle_frame(frame, frame_len);
+            frame_len = 0;
+            overflow = false;
+        }
+    }
+
+    fprintf(stderr, "%lu quadros validos, %lu descartados\n", frames_ok, frames_bad);
+    return 0;
+}